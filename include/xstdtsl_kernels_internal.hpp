@@ -0,0 +1,17 @@
+#pragma once
+#include <xstdtsl_system_C.h>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define __XSTDTSL_X86
+#endif
+
+namespace xstdtsl_internal
+{
+	///
+	/// kernel tables for each instruction set level; tables for levels that are not supported by the compiler or architecture contain the scalar kernels
+	///
+	extern const xstdtsl_kernel_table g_cKernels_Scalar;
+	extern const xstdtsl_kernel_table g_cKernels_SSE42;
+	extern const xstdtsl_kernel_table g_cKernels_AVX2;
+	extern const xstdtsl_kernel_table g_cKernels_AVX512;
+}
@@ -4,11 +4,144 @@
 #else
 #define __XSTDTSL_EXPORT
 #endif
+#include <cstddef>
+#include <cstdint>
+
+///
+/// cache line size assumed for padding of data shared between threads
+///
+#define XSTDTSL_CACHE_LINE_SIZE 64
+
+///
+/// cpu feature flags used to select vectorized kernels
+///
+enum xstdtsl_cpu_feature
+{
+	XSTDTSL_CPU_SCALAR = 0, ///< no vector extensions; portable kernels only
+	XSTDTSL_CPU_SSE42 = 1, ///< SSE4.2 (and all prior SSE extensions)
+	XSTDTSL_CPU_AVX2 = 2, ///< AVX2
+	XSTDTSL_CPU_AVX512 = 4 ///< AVX-512 foundation
+};
+
+///
+/// memory placement policies for container storage on NUMA systems; on systems without NUMA support all policies behave as XSTDTSL_NUMA_DEFAULT
+///
+enum xstdtsl_numa_policy
+{
+	XSTDTSL_NUMA_DEFAULT = 0, ///< use the process / thread policy; normally the node of the thread that first touches the memory
+	XSTDTSL_NUMA_LOCAL = 1, ///< place memory on the node of the allocating thread
+	XSTDTSL_NUMA_INTERLEAVE = 2, ///< interleave pages across all nodes; suited to large tables shared by threads on many nodes
+	XSTDTSL_NUMA_BIND = 3 ///< place memory only on a specified node
+};
+
+///
+/// the way in which a block from xstdtsl_block_alloc was obtained; must be passed back to xstdtsl_block_free
+///
+enum xstdtsl_block_kind
+{
+	XSTDTSL_BLOCK_HEAP = 0, ///< block is from the heap
+	XSTDTSL_BLOCK_MAPPED = 1, ///< block is an anonymous mapping aligned for huge pages
+	XSTDTSL_BLOCK_ALIGNED = 2, ///< block is from the heap with an alignment larger than malloc provides
+	XSTDTSL_BLOCK_NUMA = 3 ///< block is an anonymous mapping of its own carrying a NUMA placement policy
+};
+
+///
+/// the ways of opening a file with xstdtsl_mapped_file_open
+///
+enum xstdtsl_map_mode
+{
+	XSTDTSL_MAP_OPEN_OR_CREATE = 0, ///< open the file for reading and writing, creating it empty if it does not exist
+	XSTDTSL_MAP_CREATE = 1, ///< create the file for reading and writing, discarding the contents of any existing file
+	XSTDTSL_MAP_OPEN_EXISTING = 2, ///< open an existing file for reading and writing
+	XSTDTSL_MAP_READ_ONLY = 3 ///< open an existing file for reading only
+};
+
+///
+/// a file mapped into memory in its entirety by xstdtsl_mapped_file_open; the members must only be changed by the xstdtsl_mapped_file functions
+///
+struct xstdtsl_mapped_file
+{
+	void *		pData; ///< the start of the mapping; null while the file is empty
+	size_t		nBytes; ///< the size of the file and of the mapping
+	intptr_t	iFile; ///< the file descriptor or handle; -1 if the file is not open
+	intptr_t	iMapping; ///< the file mapping handle on Windows; unused elsewhere
+	bool		bRead_Only; ///< the file was opened for reading only
+};
+
+///
+/// one buffer of a gather write with xstdtsl_fd_write
+///
+struct xstdtsl_io_buffer
+{
+	const void *	pData; ///< the bytes to write
+	size_t			nBytes; ///< the number of bytes to write
+};
+
+///
+/// table of kernels selected at runtime for the best instruction set available; all kernels operate on raw buffers
+///
+struct xstdtsl_kernel_table
+{
+	unsigned int	uFeature_Level; ///< the single xstdtsl_cpu_feature value that this table was built for
+	size_t (*find_32)(const void * i_pData, size_t i_nCount, uint32_t i_uValue) noexcept; ///< find the first 32-bit element equal to a value; returns i_nCount if not found
+	size_t (*find_64)(const void * i_pData, size_t i_nCount, uint64_t i_uValue) noexcept; ///< find the first 64-bit element equal to a value; returns i_nCount if not found
+	size_t (*find_f32)(const void * i_pData, size_t i_nCount, float i_fValue) noexcept; ///< find the first float equal to a value, comparing as floating point; returns i_nCount if not found
+	size_t (*find_f64)(const void * i_pData, size_t i_nCount, double i_dValue) noexcept; ///< find the first double equal to a value, comparing as floating point; returns i_nCount if not found
+	size_t (*count_32)(const void * i_pData, size_t i_nCount, uint32_t i_uValue) noexcept; ///< count the 32-bit elements equal to a value
+	size_t (*count_64)(const void * i_pData, size_t i_nCount, uint64_t i_uValue) noexcept; ///< count the 64-bit elements equal to a value
+	size_t (*count_f32)(const void * i_pData, size_t i_nCount, float i_fValue) noexcept; ///< count the floats equal to a value, comparing as floating point
+	size_t (*count_f64)(const void * i_pData, size_t i_nCount, double i_dValue) noexcept; ///< count the doubles equal to a value, comparing as floating point
+	void (*minmax_i32)(const void * i_pData, size_t i_nCount, int32_t * o_piMin, int32_t * o_piMax) noexcept; ///< find the smallest and largest signed 32-bit elements; the count must not be 0
+	void (*minmax_i64)(const void * i_pData, size_t i_nCount, int64_t * o_piMin, int64_t * o_piMax) noexcept; ///< find the smallest and largest signed 64-bit elements; the count must not be 0
+	void (*minmax_f32)(const void * i_pData, size_t i_nCount, float * o_pfMin, float * o_pfMax) noexcept; ///< find the smallest and largest floats, ignoring NaN; gives +inf and -inf if every element is NaN
+	void (*minmax_f64)(const void * i_pData, size_t i_nCount, double * o_pdMin, double * o_pdMax) noexcept; ///< find the smallest and largest doubles, ignoring NaN; gives +inf and -inf if every element is NaN
+	int64_t (*sum_i32)(const void * i_pData, size_t i_nCount) noexcept; ///< sum signed 32-bit elements without overflow
+	int64_t (*sum_i64)(const void * i_pData, size_t i_nCount) noexcept; ///< sum signed 64-bit elements; wraps on overflow
+	double (*sum_f32)(const void * i_pData, size_t i_nCount) noexcept; ///< sum floats, accumulating in double
+	double (*sum_f64)(const void * i_pData, size_t i_nCount) noexcept; ///< sum doubles; the vector kernels add in a different order to a sequential loop, so the result may differ in the last bits
+};
 
 extern "C"
 {
 	__XSTDTSL_EXPORT size_t xstdtsl_get_word_size(void) noexcept;
+	__XSTDTSL_EXPORT size_t xstdtsl_get_cache_line_size(void) noexcept;
+	__XSTDTSL_EXPORT size_t xstdtsl_get_page_size(void) noexcept;
 	__XSTDTSL_EXPORT size_t xstdtsl_get_available_memory(void) noexcept;
+	__XSTDTSL_EXPORT size_t xstdtsl_get_available_memory_cgroup(void) noexcept;
+	__XSTDTSL_EXPORT size_t xstdtsl_get_container_memory_limit(void) noexcept;
+	__XSTDTSL_EXPORT size_t xstdtsl_get_available_memory_cached(void) noexcept;
+	__XSTDTSL_EXPORT void xstdtsl_set_available_memory_refresh_interval(size_t i_nMicroseconds) noexcept;
+	__XSTDTSL_EXPORT size_t xstdtsl_get_available_memory_refresh_interval(void) noexcept;
+	__XSTDTSL_EXPORT void xstdtsl_set_available_memory_cgroup_aware(bool i_bCgroup_Aware) noexcept;
+	__XSTDTSL_EXPORT bool xstdtsl_start_available_memory_monitor(void) noexcept;
+	__XSTDTSL_EXPORT void xstdtsl_stop_available_memory_monitor(void) noexcept;
+	__XSTDTSL_EXPORT size_t xstdtsl_get_numa_node_count(void) noexcept;
+	__XSTDTSL_EXPORT void * xstdtsl_numa_alloc(size_t i_nBytes, int i_iPolicy, int i_iNode) noexcept;
+	__XSTDTSL_EXPORT void xstdtsl_numa_free(void * i_pMemory, size_t i_nBytes, int i_iPolicy) noexcept;
+	__XSTDTSL_EXPORT bool xstdtsl_numa_apply(void * i_pMemory, size_t i_nBytes, int i_iPolicy, int i_iNode) noexcept;
+	__XSTDTSL_EXPORT bool xstdtsl_numa_set_thread_policy(int i_iPolicy, int i_iNode) noexcept;
+	__XSTDTSL_EXPORT bool xstdtsl_huge_pages_available(void) noexcept;
+	__XSTDTSL_EXPORT void xstdtsl_set_huge_page_threshold(size_t i_nBytes) noexcept;
+	__XSTDTSL_EXPORT size_t xstdtsl_get_huge_page_threshold(void) noexcept;
+	__XSTDTSL_EXPORT void * xstdtsl_block_alloc(size_t i_nBytes, int i_iPolicy, int i_iNode, int * o_piKind) noexcept;
+	__XSTDTSL_EXPORT void * xstdtsl_block_alloc_aligned(size_t i_nBytes, size_t i_nAlignment, int i_iPolicy, int i_iNode, int * o_piKind) noexcept;
+	__XSTDTSL_EXPORT void xstdtsl_block_free(void * i_pMemory, size_t i_nBytes, int i_iKind) noexcept;
+	__XSTDTSL_EXPORT unsigned int xstdtsl_get_cpu_features(void) noexcept;
+	__XSTDTSL_EXPORT unsigned int xstdtsl_get_detected_cpu_features(void) noexcept;
+	__XSTDTSL_EXPORT void xstdtsl_set_cpu_feature_mask(unsigned int i_uMask) noexcept;
+	__XSTDTSL_EXPORT const xstdtsl_kernel_table * xstdtsl_get_kernel_table(void) noexcept;
+	__XSTDTSL_EXPORT int xstdtsl_mapped_file_open(const char * i_pPath, int i_iMode, xstdtsl_mapped_file * o_pFile) noexcept;
+	__XSTDTSL_EXPORT int xstdtsl_mapped_file_resize(xstdtsl_mapped_file * io_pFile, size_t i_nBytes) noexcept;
+	__XSTDTSL_EXPORT int xstdtsl_mapped_file_sync(const xstdtsl_mapped_file * i_pFile, size_t i_nOffset, size_t i_nBytes, bool i_bWait) noexcept;
+	__XSTDTSL_EXPORT void xstdtsl_mapped_file_prefetch(const xstdtsl_mapped_file * i_pFile, size_t i_nOffset, size_t i_nBytes) noexcept;
+	__XSTDTSL_EXPORT void xstdtsl_mapped_file_close(xstdtsl_mapped_file * io_pFile) noexcept;
+	__XSTDTSL_EXPORT int xstdtsl_fd_write(int i_iFile, const xstdtsl_io_buffer * i_pBuffers, size_t i_nBuffers) noexcept;
+	__XSTDTSL_EXPORT int xstdtsl_fd_read(int i_iFile, void * o_pData, size_t i_nBytes, size_t * o_pnRead) noexcept;
+	__XSTDTSL_EXPORT void xstdtsl_wait_on_address(const void * i_pAddress, uint32_t i_uExpected) noexcept;
+	__XSTDTSL_EXPORT void xstdtsl_wake_on_address(const void * i_pAddress, bool i_bAll) noexcept;
+	__XSTDTSL_EXPORT void xstdtsl_set_parallel_threads(size_t i_nThreads) noexcept;
+	__XSTDTSL_EXPORT size_t xstdtsl_get_parallel_threads(void) noexcept;
+	__XSTDTSL_EXPORT void xstdtsl_parallel_run(size_t i_nTasks, void (*i_fnTask)(void * i_pContext, size_t i_nTask) noexcept, void * i_pContext) noexcept;
 }
 
 
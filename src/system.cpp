@@ -1,20 +1,136 @@
 #if defined _WIN32 || defined _WIN64
 #define __XSTDTSL_WINDOWS
 #include <windows.h>
+#include <malloc.h>
 #else
 #include <unistd.h>
 #endif
+#if defined __linux__
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#endif
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#include <string>
+#include <system_error>
 
 #include <xstdtsl_system_C.h>
+#include <xstdtsl_kernels_internal.hpp>
+#if defined __XSTDTSL_X86 && defined _MSC_VER
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+///
+/// detect the vector extensions supported by both the cpu and the operating system
+/// \returns a combination of xstdtsl_cpu_feature flags
+///
+static unsigned int detect_cpu_features(void) noexcept
+{
+	unsigned int uRet = XSTDTSL_CPU_SCALAR;
+#if defined __XSTDTSL_X86
+#if defined _MSC_VER
+	int iInfo[4];
+	__cpuid(iInfo,0);
+	int iMax_Leaf = iInfo[0];
+	__cpuid(iInfo,1);
+	bool bOSXSAVE = (iInfo[2] & (1 << 27)) != 0;
+	if ((iInfo[2] & (1 << 20)) != 0)
+		uRet |= XSTDTSL_CPU_SSE42;
+	if (bOSXSAVE && iMax_Leaf >= 7)
+	{
+		unsigned long long uXCR0 = _xgetbv(0);
+		__cpuidex(iInfo,7,0);
+		if ((uXCR0 & 0x6) == 0x6 && (iInfo[1] & (1 << 5)) != 0)
+			uRet |= XSTDTSL_CPU_AVX2;
+		if ((uXCR0 & 0xe6) == 0xe6 && (iInfo[1] & (1 << 16)) != 0)
+			uRet |= XSTDTSL_CPU_AVX512;
+	}
+#else
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("sse4.2"))
+		uRet |= XSTDTSL_CPU_SSE42;
+	if (__builtin_cpu_supports("avx2"))
+		uRet |= XSTDTSL_CPU_AVX2;
+	if (__builtin_cpu_supports("avx512f"))
+		uRet |= XSTDTSL_CPU_AVX512;
+#endif
+#endif
+	return uRet;
+}
+
+///
+/// determine the size of a level 1 data cache line
+/// \returns the cache line size in bytes; XSTDTSL_CACHE_LINE_SIZE if it can not be determined
+///
+static size_t detect_cache_line_size(void) noexcept
+{
+	size_t nRet = 0;
+#ifdef __XSTDTSL_WINDOWS
+	DWORD dwLength = 0;
+	GetLogicalProcessorInformation(nullptr,&dwLength);
+	SYSTEM_LOGICAL_PROCESSOR_INFORMATION * pInfo = reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION *>(std::malloc(dwLength));
+	if (pInfo != nullptr && GetLogicalProcessorInformation(pInfo,&dwLength))
+	{
+		for (size_t nI = 0; nI < dwLength / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION) && nRet == 0; nI++)
+		{
+			if (pInfo[nI].Relationship == RelationCache && pInfo[nI].Cache.Level == 1)
+				nRet = pInfo[nI].Cache.LineSize;
+		}
+	}
+	std::free(pInfo);
+#else
+#ifdef _SC_LEVEL1_DCACHE_LINESIZE
+	long lLine_Size = sysconf(_SC_LEVEL1_DCACHE_LINESIZE);
+	if (lLine_Size > 0)
+		nRet = (size_t)lLine_Size;
+#endif
+	if (nRet == 0)
+	{
+		FILE * pFile = std::fopen("/sys/devices/system/cpu/cpu0/cache/index0/coherency_line_size","r");
+		if (pFile != nullptr)
+		{
+			unsigned long ulLine_Size = 0;
+			if (std::fscanf(pFile,"%lu",&ulLine_Size) == 1)
+				nRet = ulLine_Size;
+			std::fclose(pFile);
+		}
+	}
+#endif
+	// only a power of two is usable as an alignment
+	if (nRet == 0 || (nRet & (nRet - 1)) != 0)
+		nRet = XSTDTSL_CACHE_LINE_SIZE;
+	return nRet;
+}
+///
+/// get the vector extensions detected on first use; cpuid and the operating system query run once, and the result does not depend on the order in which static objects are constructed
+/// \returns a combination of xstdtsl_cpu_feature flags
+///
+static unsigned int cached_cpu_features(void) noexcept
+{
+	static const unsigned int g_uFeatures = detect_cpu_features();
+	return g_uFeatures;
+}
 
 class system_data
 {
 public:
 	size_t		m_nWord_Size;
 	size_t		m_nPage_Size;
+	size_t		m_nCache_Line_Size; ///< size of a level 1 data cache line in bytes
+	unsigned int	m_uCPU_Features; ///< vector extensions detected at startup
 
 	system_data(void)
 	{
+		m_uCPU_Features = cached_cpu_features();
 #ifdef __XSTDTSL_WINDOWS
 		SYSTEM_INFO sSys_Info;
 		GetNativeSystemInfo(&sSys_Info);
@@ -22,6 +138,7 @@ public:
 #else
 		m_nPage_Size = sysconf(_SC_PAGE_SIZE);
 #endif
+		m_nCache_Line_Size = detect_cache_line_size();
 		if (sizeof(long double) == 16) /// use long double as an indicator of 64-bit vs 32-bit memory alighnment; this is actually compiler dependent, but it is a reasonable guess
 			m_nWord_Size = 8;
 		else
@@ -32,11 +149,132 @@ public:
 system_data	g_cSystem_Data;
 bool		g_bAllow_Exceptions = true;
 
+///
+/// selects the kernel table for the detected cpu features, restricted by a mask that may be set for testing; the mask may also be set with the environment variable XSTDTSL_CPU_FEATURES (e.g. XSTDTSL_CPU_FEATURES=0 forces the scalar kernels)
+///
+class kernel_dispatch
+{
+public:
+	std::atomic<unsigned int>					m_uFeature_Mask; ///< mask applied to the detected features
+	std::atomic<const xstdtsl_kernel_table *>	m_pTable; ///< the currently selected kernel table; nullptr until first use
+
+	kernel_dispatch(void) : m_uFeature_Mask(~0u), m_pTable(nullptr)
+	{
+		const char * pMask = std::getenv("XSTDTSL_CPU_FEATURES");
+		if (pMask != nullptr && pMask[0] != 0)
+			m_uFeature_Mask = (unsigned int)std::strtoul(pMask,nullptr,0);
+	}
+	const xstdtsl_kernel_table * select(void) noexcept
+	{
+		unsigned int uFeatures = cached_cpu_features() & m_uFeature_Mask.load(std::memory_order_relaxed);
+		const xstdtsl_kernel_table * pRet = &xstdtsl_internal::g_cKernels_Scalar;
+		if (uFeatures & XSTDTSL_CPU_AVX512)
+			pRet = &xstdtsl_internal::g_cKernels_AVX512;
+		else if (uFeatures & XSTDTSL_CPU_AVX2)
+			pRet = &xstdtsl_internal::g_cKernels_AVX2;
+		else if (uFeatures & XSTDTSL_CPU_SSE42)
+			pRet = &xstdtsl_internal::g_cKernels_SSE42;
+		m_pTable.store(pRet,std::memory_order_release);
+		return pRet;
+	}
+};
+kernel_dispatch g_cKernel_Dispatch;
+
+///
+/// cached value of the available memory; refreshed when older than the refresh interval or by an optional background thread
+///
+class memory_cache
+{
+public:
+	std::atomic<size_t>		m_nAvailable_Memory; ///< the most recent available memory value, in bytes
+	std::atomic<int64_t>	m_iLast_Refresh; ///< time of last refresh in steady_clock nanoseconds
+	std::atomic<int64_t>	m_iRefresh_Interval; ///< refresh interval in nanoseconds; 0 indicates that every query refreshes
+	std::atomic<bool>		m_bCgroup_Aware; ///< flag to indicate that the cached value should honor the container (cgroup) memory limit
+	std::atomic<bool>		m_bMonitor_Running; ///< flag to indicate that the background refresh thread is running
+	std::mutex				m_mMonitor_Mutex; ///< mutex used for starting and stopping the background thread
+	std::condition_variable	m_cvMonitor; ///< condition used to wake the background thread when it is stopped
+	std::thread				m_cMonitor_Thread; ///< the background refresh thread
+
+	memory_cache(void) : m_nAvailable_Memory(0), m_iLast_Refresh(0), m_iRefresh_Interval(100000000), m_bCgroup_Aware(false), m_bMonitor_Running(false)
+	{
+	}
+	~memory_cache(void)
+	{
+		stop_monitor();
+	}
+	static int64_t now(void) noexcept
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+	void refresh(void) noexcept
+	{
+		size_t nValue;
+		if (m_bCgroup_Aware.load(std::memory_order_relaxed))
+			nValue = xstdtsl_get_available_memory_cgroup();
+		else
+			nValue = xstdtsl_get_available_memory();
+		m_nAvailable_Memory.store(nValue,std::memory_order_relaxed);
+		m_iLast_Refresh.store(now(),std::memory_order_relaxed);
+	}
+	void monitor(void) noexcept
+	{
+		std::unique_lock<std::mutex> cLock(m_mMonitor_Mutex);
+		while (m_bMonitor_Running.load(std::memory_order_relaxed))
+		{
+			refresh();
+			int64_t iInterval = m_iRefresh_Interval.load(std::memory_order_relaxed);
+			if (iInterval <= 0)
+				iInterval = 1000000; // the monitor needs some interval; use 1 ms
+			m_cvMonitor.wait_for(cLock,std::chrono::nanoseconds(iInterval));
+		}
+	}
+	bool start_monitor(void) noexcept
+	{
+		std::lock_guard<std::mutex> cLock(m_mMonitor_Mutex);
+		if (!m_bMonitor_Running.load())
+		{
+			refresh();
+			m_bMonitor_Running = true;
+			try
+			{
+				m_cMonitor_Thread = std::thread(&memory_cache::monitor,this);
+			}
+			catch (const std::system_error &)
+			{
+				// the thread could not be created; queries keep refreshing on demand
+				m_bMonitor_Running = false;
+			}
+		}
+		return m_bMonitor_Running.load();
+	}
+	void stop_monitor(void) noexcept
+	{
+		{
+			std::lock_guard<std::mutex> cLock(m_mMonitor_Mutex);
+			m_bMonitor_Running = false;
+		}
+		m_cvMonitor.notify_all();
+		if (m_cMonitor_Thread.joinable())
+			m_cMonitor_Thread.join();
+	}
+};
+memory_cache g_cMemory_Cache;
+
 size_t xstdtsl_get_word_size(void) noexcept
 {
 	return g_cSystem_Data.m_nWord_Size;
 }
 
+size_t xstdtsl_get_cache_line_size(void) noexcept
+{
+	return g_cSystem_Data.m_nCache_Line_Size;
+}
+
+size_t xstdtsl_get_page_size(void) noexcept
+{
+	return g_cSystem_Data.m_nPage_Size;
+}
+
 size_t xstdtsl_get_available_memory(void) noexcept
 {
 	size_t nRet;
@@ -50,7 +288,583 @@ size_t xstdtsl_get_available_memory(void) noexcept
 	return nRet;
 }
 
+#ifndef __XSTDTSL_WINDOWS
+///
+/// read a single unsigned value from a cgroup file
+/// \returns true if the file exists and contains a number; false if the file does not exist or contains "max" or other non-numeric data
+///
+static bool read_cgroup_value(const char * i_pFilename, size_t & o_nValue) noexcept
+{
+	bool bRet = false;
+	FILE * pFile = std::fopen(i_pFilename,"r");
+	if (pFile != nullptr)
+	{
+		unsigned long long nValue;
+		if (std::fscanf(pFile,"%llu",&nValue) == 1)
+		{
+			o_nValue = (size_t)nValue;
+			bRet = true;
+		}
+		std::fclose(pFile);
+	}
+	return bRet;
+}
+#endif
+
+#ifndef __XSTDTSL_WINDOWS
+///
+/// find the memory cgroup of the calling process from /proc/self/cgroup; a cgroup v1 memory controller is preferred, as on hybrid systems it holds the memory limits, otherwise the cgroup v2 unified hierarchy is used
+/// \returns true if the process's memory cgroup was found; false if /proc/self/cgroup can not be read or lists neither hierarchy
+///
+static bool find_memory_cgroup(
+	std::string & o_sPath, ///< receives the path of the cgroup within its hierarchy, e.g. "/user.slice/session-1.scope"
+	bool & o_bV1 ///< receives true for a cgroup v1 memory controller; false for cgroup v2
+	) noexcept(false) // throws std::bad_alloc
+{
+	bool bRet = false;
+	FILE * pFile = std::fopen("/proc/self/cgroup","r");
+	if (pFile != nullptr)
+	{
+		char chLine[4096];
+		while (std::fgets(chLine,sizeof(chLine),pFile) != nullptr)
+		{
+			// each line is hierarchy-id:controller-list:path
+			char * pControllers = std::strchr(chLine,':');
+			char * pPath = pControllers != nullptr ? std::strchr(pControllers + 1,':') : nullptr;
+			if (pPath != nullptr)
+			{
+				std::string sControllers = "," + std::string(pControllers + 1,pPath) + ",";
+				std::string sPath(pPath + 1);
+				while (!sPath.empty() && (sPath.back() == '\n' || sPath.back() == '\r'))
+					sPath.pop_back();
+				if (sControllers.find(",memory,") != std::string::npos)
+				{
+					o_sPath = sPath;
+					o_bV1 = true;
+					bRet = true;
+				}
+				else if (sControllers == ",," && std::strncmp(chLine,"0:",2) == 0 && !(bRet && o_bV1))
+				{
+					o_sPath = sPath;
+					o_bV1 = false;
+					bRet = true;
+				}
+			}
+		}
+		std::fclose(pFile);
+	}
+	return bRet;
+}
+///
+/// read the memory limit and the memory available under it for the calling process's cgroup. the process is limited by its own group and every ancestor, so the tightest limit and the least available memory over the group and its ancestors are reported. when the group is not visible under /sys/fs/cgroup, as in a container without a cgroup namespace, the ancestors that are visible, ending with the mount root, are used
+///
+static void read_cgroup_memory(
+	size_t & o_nLimit, ///< receives the tightest limit, in bytes; 0 if there is no limit
+	size_t & o_nAvailable ///< receives the least memory available under a limit, in bytes; SIZE_MAX if there is no limit
+	) noexcept
+{
+	o_nLimit = 0;
+	o_nAvailable = SIZE_MAX;
+	try
+	{
+		std::string sPath;
+		bool bV1 = false;
+		if (!find_memory_cgroup(sPath,bV1))
+		{
+			// no /proc/self/cgroup; use whichever hierarchy is mounted
+			sPath = "/";
+			size_t nValue;
+			bV1 = !read_cgroup_value("/sys/fs/cgroup/memory.max",nValue) && read_cgroup_value("/sys/fs/cgroup/memory/memory.limit_in_bytes",nValue);
+		}
+		std::string sRoot = bV1 ? "/sys/fs/cgroup/memory" : "/sys/fs/cgroup";
+		const char * pLimit_File = bV1 ? "/memory.limit_in_bytes" : "/memory.max";
+		const char * pUsage_File = bV1 ? "/memory.usage_in_bytes" : "/memory.current";
+		std::string sDirectory = sRoot + sPath;
+		while (sDirectory.size() > sRoot.size() && sDirectory.back() == '/')
+			sDirectory.pop_back();
+		for (;;)
+		{
+			size_t nLimit;
+			// cgroup v1 reports an unlimited group as a very large, page aligned number; cgroup v2 reports "max", which is not read as a number
+			if (read_cgroup_value((sDirectory + pLimit_File).c_str(),nLimit) && nLimit < ((size_t)1 << 62))
+			{
+				size_t nUsage = 0;
+				read_cgroup_value((sDirectory + pUsage_File).c_str(),nUsage);
+				size_t nAvailable = nUsage < nLimit ? nLimit - nUsage : 0;
+				if (o_nLimit == 0 || nLimit < o_nLimit)
+					o_nLimit = nLimit;
+				if (nAvailable < o_nAvailable)
+					o_nAvailable = nAvailable;
+			}
+			if (sDirectory.size() <= sRoot.size())
+				break;
+			size_t nSlash = sDirectory.rfind('/');
+			sDirectory.resize(nSlash > sRoot.size() ? nSlash : sRoot.size());
+		}
+	}
+	catch (...)
+	{
+		o_nLimit = 0;
+		o_nAvailable = SIZE_MAX;
+	}
+}
+#endif
+
+size_t xstdtsl_get_container_memory_limit(void) noexcept
+{
+	size_t nRet = 0;
+#ifndef __XSTDTSL_WINDOWS
+	size_t nAvailable;
+	read_cgroup_memory(nRet,nAvailable);
+#endif
+	return nRet;
+}
+
+size_t xstdtsl_get_available_memory_cgroup(void) noexcept
+{
+	size_t nRet = xstdtsl_get_available_memory();
+#ifndef __XSTDTSL_WINDOWS
+	size_t nLimit, nContainer_Available;
+	read_cgroup_memory(nLimit,nContainer_Available);
+	if (nContainer_Available < nRet)
+		nRet = nContainer_Available;
+#endif
+	return nRet;
+}
+
+size_t xstdtsl_get_available_memory_cached(void) noexcept
+{
+	if (!g_cMemory_Cache.m_bMonitor_Running.load(std::memory_order_relaxed))
+	{
+		int64_t iLast = g_cMemory_Cache.m_iLast_Refresh.load(std::memory_order_relaxed);
+		if (iLast == 0 || (memory_cache::now() - iLast) >= g_cMemory_Cache.m_iRefresh_Interval.load(std::memory_order_relaxed))
+			g_cMemory_Cache.refresh();
+	}
+	return g_cMemory_Cache.m_nAvailable_Memory.load(std::memory_order_relaxed);
+}
+
+void xstdtsl_set_available_memory_refresh_interval(size_t i_nMicroseconds) noexcept
+{
+	g_cMemory_Cache.m_iRefresh_Interval.store((int64_t)i_nMicroseconds * 1000,std::memory_order_relaxed);
+	g_cMemory_Cache.m_cvMonitor.notify_all();
+}
+
+size_t xstdtsl_get_available_memory_refresh_interval(void) noexcept
+{
+	return (size_t)(g_cMemory_Cache.m_iRefresh_Interval.load(std::memory_order_relaxed) / 1000);
+}
+
+void xstdtsl_set_available_memory_cgroup_aware(bool i_bCgroup_Aware) noexcept
+{
+	g_cMemory_Cache.m_bCgroup_Aware.store(i_bCgroup_Aware,std::memory_order_relaxed);
+	g_cMemory_Cache.m_iLast_Refresh.store(0,std::memory_order_relaxed); // force refresh on next query
+}
+
+bool xstdtsl_start_available_memory_monitor(void) noexcept
+{
+	return g_cMemory_Cache.start_monitor();
+}
+
+void xstdtsl_stop_available_memory_monitor(void) noexcept
+{
+	g_cMemory_Cache.stop_monitor();
+}
+
+///
+/// number of numa nodes; read from sysfs on first use
+///
+class numa_data
+{
+public:
+	size_t		m_nNode_Count; ///< the number of online nodes (highest node number + 1)
+
+	numa_data(void)
+	{
+		m_nNode_Count = 1;
+#if defined __linux__
+		FILE * pFile = std::fopen("/sys/devices/system/node/online","r");
+		if (pFile != nullptr)
+		{
+			// format is a list of ranges, e.g. "0" or "0-3" or "0,2-3"; only the highest node number matters
+			char lpszBuffer[256];
+			if (std::fgets(lpszBuffer,sizeof(lpszBuffer),pFile) != nullptr)
+			{
+				size_t nHighest = 0;
+				size_t nValue = 0;
+				bool bDigits = false;
+				for (char * pC = lpszBuffer; *pC != 0; pC++)
+				{
+					if (*pC >= '0' && *pC <= '9')
+					{
+						nValue = nValue * 10 + (*pC - '0');
+						bDigits = true;
+					}
+					else
+					{
+						if (bDigits && nValue > nHighest)
+							nHighest = nValue;
+						nValue = 0;
+						bDigits = false;
+					}
+				}
+				if (bDigits && nValue > nHighest)
+					nHighest = nValue;
+				m_nNode_Count = nHighest + 1;
+			}
+			std::fclose(pFile);
+		}
+#endif
+	}
+};
+
+#if defined __linux__ && defined SYS_mbind && defined SYS_set_mempolicy
+#define __XSTDTSL_NUMA
+static const int g_iMPOL_DEFAULT = 0;
+static const int g_iMPOL_BIND = 2;
+static const int g_iMPOL_INTERLEAVE = 3;
+static const int g_iMPOL_LOCAL = 4;
+static const unsigned int g_uMPOL_MF_MOVE = 1 << 1;
+static const size_t g_nMax_Nodes = 1024;
+
+///
+/// convert an xstdtsl_numa_policy and node into a kernel policy mode and node mask
+/// \returns the kernel policy mode
+///
+static int numa_mode(int i_iPolicy, int i_iNode, unsigned long * o_lpulMask, size_t i_nMask_Words) noexcept
+{
+	int iRet = g_iMPOL_DEFAULT;
+	for (size_t nI = 0; nI < i_nMask_Words; nI++)
+		o_lpulMask[nI] = 0;
+	const size_t nBits = sizeof(unsigned long) * 8;
+	switch (i_iPolicy)
+	{
+	case XSTDTSL_NUMA_LOCAL:
+		iRet = g_iMPOL_LOCAL;
+		break;
+	case XSTDTSL_NUMA_INTERLEAVE:
+		{
+			iRet = g_iMPOL_INTERLEAVE;
+			size_t nNodes = xstdtsl_get_numa_node_count();
+			for (size_t nI = 0; nI < nNodes && nI < i_nMask_Words * nBits; nI++)
+				o_lpulMask[nI / nBits] |= 1ul << (nI % nBits);
+		}
+		break;
+	case XSTDTSL_NUMA_BIND:
+		if (i_iNode >= 0 && (size_t)i_iNode < i_nMask_Words * nBits)
+		{
+			iRet = g_iMPOL_BIND;
+			o_lpulMask[i_iNode / nBits] |= 1ul << (i_iNode % nBits);
+		}
+		break;
+	default:
+		break;
+	}
+	return iRet;
+}
+#endif
+
+size_t xstdtsl_get_numa_node_count(void) noexcept
+{
+	static numa_data g_cNUMA_Data;
+	return g_cNUMA_Data.m_nNode_Count;
+}
+
+bool xstdtsl_numa_apply(void * i_pMemory, size_t i_nBytes, int i_iPolicy, int i_iNode) noexcept
+{
+	bool bRet = false;
+#ifdef __XSTDTSL_NUMA
+	if (i_pMemory != nullptr && i_nBytes > 0)
+	{
+		// mbind operates on whole pages; apply the policy to the pages that lie completely within the range
+		uintptr_t uStart = reinterpret_cast<uintptr_t>(i_pMemory);
+		uintptr_t uEnd = uStart + i_nBytes;
+		uintptr_t uPage = g_cSystem_Data.m_nPage_Size;
+		uStart = (uStart + uPage - 1) & ~(uPage - 1);
+		uEnd &= ~(uPage - 1);
+		if (uEnd > uStart)
+		{
+			unsigned long lpulMask[g_nMax_Nodes / (sizeof(unsigned long) * 8)];
+			size_t nMask_Words = sizeof(lpulMask) / sizeof(unsigned long);
+			int iMode = numa_mode(i_iPolicy,i_iNode,lpulMask,nMask_Words);
+			unsigned long * pMask = (iMode == g_iMPOL_BIND || iMode == g_iMPOL_INTERLEAVE) ? lpulMask : nullptr;
+			bRet = syscall(SYS_mbind,uStart,uEnd - uStart,iMode,pMask,pMask != nullptr ? g_nMax_Nodes : 0,g_uMPOL_MF_MOVE) == 0;
+		}
+	}
+#endif
+	return bRet;
+}
+
+#ifdef __XSTDTSL_NUMA
+///
+/// map a block of whole pages and apply a placement policy to it. the block has its own mapping so that the policy never reaches pages that the heap later hands to other allocations; release with numa_map_free
+/// \returns the block; nullptr on failure
+///
+static void * numa_map_alloc(size_t i_nBytes, size_t i_nAlignment, int i_iPolicy, int i_iNode) noexcept
+{
+	void * pRet = nullptr;
+	size_t nPage = g_cSystem_Data.m_nPage_Size;
+	size_t nBytes = (i_nBytes + nPage - 1) & ~(nPage - 1);
+	// mappings are page aligned; over-map and trim for larger alignments
+	size_t nSlack = i_nAlignment > nPage ? i_nAlignment : 0;
+	size_t nMap_Size = nBytes + nSlack;
+	void * pMap = mmap(nullptr,nMap_Size,PROT_READ | PROT_WRITE,MAP_PRIVATE | MAP_ANONYMOUS,-1,0);
+	if (pMap != MAP_FAILED)
+	{
+		uintptr_t uMap = reinterpret_cast<uintptr_t>(pMap);
+		uintptr_t uAligned = nSlack > 0 ? (uMap + nSlack - 1) & ~(nSlack - 1) : uMap;
+		if (uAligned > uMap)
+			munmap(pMap,uAligned - uMap);
+		if (uMap + nMap_Size > uAligned + nBytes)
+			munmap(reinterpret_cast<void *>(uAligned + nBytes),uMap + nMap_Size - (uAligned + nBytes));
+		pRet = reinterpret_cast<void *>(uAligned);
+		xstdtsl_numa_apply(pRet,nBytes,i_iPolicy,i_iNode);
+	}
+	return pRet;
+}
+
+///
+/// release a block from numa_map_alloc
+///
+static void numa_map_free(void * i_pMemory, size_t i_nBytes) noexcept
+{
+	size_t nPage = g_cSystem_Data.m_nPage_Size;
+	if (i_pMemory != nullptr)
+		munmap(i_pMemory,(i_nBytes + nPage - 1) & ~(nPage - 1));
+}
+#endif
+
+void * xstdtsl_numa_alloc(size_t i_nBytes, int i_iPolicy, int i_iNode) noexcept
+{
+	void * pRet = nullptr;
+	if (i_nBytes > 0)
+	{
+#ifdef __XSTDTSL_NUMA
+		if (i_iPolicy != XSTDTSL_NUMA_DEFAULT)
+			pRet = numa_map_alloc(i_nBytes,0,i_iPolicy,i_iNode);
+		else
+#endif
+			pRet = std::malloc(i_nBytes);
+	}
+	return pRet;
+}
+
+void xstdtsl_numa_free(void * i_pMemory, size_t i_nBytes, int i_iPolicy) noexcept
+{
+#ifdef __XSTDTSL_NUMA
+	if (i_iPolicy != XSTDTSL_NUMA_DEFAULT)
+		numa_map_free(i_pMemory,i_nBytes);
+	else
+#endif
+		std::free(i_pMemory);
+}
+
+bool xstdtsl_numa_set_thread_policy(int i_iPolicy, int i_iNode) noexcept
+{
+	bool bRet = false;
+#ifdef __XSTDTSL_NUMA
+	unsigned long lpulMask[g_nMax_Nodes / (sizeof(unsigned long) * 8)];
+	size_t nMask_Words = sizeof(lpulMask) / sizeof(unsigned long);
+	int iMode = numa_mode(i_iPolicy,i_iNode,lpulMask,nMask_Words);
+	unsigned long * pMask = (iMode == g_iMPOL_BIND || iMode == g_iMPOL_INTERLEAVE) ? lpulMask : nullptr;
+	bRet = syscall(SYS_set_mempolicy,iMode,pMask,pMask != nullptr ? g_nMax_Nodes : 0) == 0;
+#endif
+	return bRet;
+}
+
+#if defined __linux__ && defined MADV_HUGEPAGE
+#define __XSTDTSL_HUGE_PAGES
+#endif
+static const size_t g_nHuge_Page_Size = 2 * 1024 * 1024;
+
+///
+/// settings for huge page backed blocks
+///
+class huge_page_data
+{
+public:
+	bool				m_bAvailable; ///< flag indicating that transparent huge pages are not disabled
+	std::atomic<size_t>	m_nThreshold; ///< blocks of at least this many bytes are mapped with huge page advice; 0 disables
+
+	huge_page_data(void) : m_bAvailable(false), m_nThreshold(8 * g_nHuge_Page_Size)
+	{
+#ifdef __XSTDTSL_HUGE_PAGES
+		FILE * pFile = std::fopen("/sys/kernel/mm/transparent_hugepage/enabled","r");
+		if (pFile != nullptr)
+		{
+			// format is e.g. "always [madvise] never"; the selected mode is in brackets
+			char lpszBuffer[128];
+			if (std::fgets(lpszBuffer,sizeof(lpszBuffer),pFile) != nullptr)
+				m_bAvailable = std::strstr(lpszBuffer,"[never]") == nullptr;
+			std::fclose(pFile);
+		}
+#endif
+	}
+};
+static huge_page_data & get_huge_page_data(void) noexcept
+{
+	static huge_page_data g_cHuge_Page_Data;
+	return g_cHuge_Page_Data;
+}
+
+bool xstdtsl_huge_pages_available(void) noexcept
+{
+	return get_huge_page_data().m_bAvailable;
+}
+
+void xstdtsl_set_huge_page_threshold(size_t i_nBytes) noexcept
+{
+	get_huge_page_data().m_nThreshold.store(i_nBytes,std::memory_order_relaxed);
+}
+
+size_t xstdtsl_get_huge_page_threshold(void) noexcept
+{
+	return get_huge_page_data().m_nThreshold.load(std::memory_order_relaxed);
+}
+
+///
+/// allocate a heap block with an alignment larger than malloc provides; release with aligned_heap_free
+/// \returns the block; nullptr on failure
+///
+static void * aligned_heap_alloc(size_t i_nBytes, size_t i_nAlignment) noexcept
+{
+	void * pRet = nullptr;
+#ifdef __XSTDTSL_WINDOWS
+	pRet = _aligned_malloc(i_nBytes,i_nAlignment);
+#else
+	if (posix_memalign(&pRet,i_nAlignment < sizeof(void *) ? sizeof(void *) : i_nAlignment,i_nBytes) != 0)
+		pRet = nullptr;
+#endif
+	return pRet;
+}
+
+///
+/// release a block from aligned_heap_alloc
+///
+static void aligned_heap_free(void * i_pMemory) noexcept
+{
+#ifdef __XSTDTSL_WINDOWS
+	_aligned_free(i_pMemory);
+#else
+	std::free(i_pMemory);
+#endif
+}
+
+void * xstdtsl_block_alloc(size_t i_nBytes, int i_iPolicy, int i_iNode, int * o_piKind) noexcept
+{
+	return xstdtsl_block_alloc_aligned(i_nBytes,0,i_iPolicy,i_iNode,o_piKind);
+}
+
+void * xstdtsl_block_alloc_aligned(size_t i_nBytes, size_t i_nAlignment, int i_iPolicy, int i_iNode, int * o_piKind) noexcept
+{
+	void * pRet = nullptr;
+	int iKind = XSTDTSL_BLOCK_HEAP;
+	if (i_nBytes > 0 && (i_nAlignment & (i_nAlignment - 1)) == 0)
+	{
+#ifdef __XSTDTSL_HUGE_PAGES
+		huge_page_data & cHuge = get_huge_page_data();
+		size_t nThreshold = cHuge.m_nThreshold.load(std::memory_order_relaxed);
+		// mapped blocks are huge page aligned, which satisfies any smaller alignment
+		if (cHuge.m_bAvailable && nThreshold > 0 && i_nBytes >= nThreshold && i_nAlignment <= g_nHuge_Page_Size)
+		{
+			// over-map so that a huge page aligned region can be trimmed from the mapping
+			size_t nBytes = (i_nBytes + g_nHuge_Page_Size - 1) & ~(g_nHuge_Page_Size - 1);
+			size_t nMap_Size = nBytes + g_nHuge_Page_Size;
+			void * pMap = mmap(nullptr,nMap_Size,PROT_READ | PROT_WRITE,MAP_PRIVATE | MAP_ANONYMOUS,-1,0);
+			if (pMap != MAP_FAILED)
+			{
+				uintptr_t uMap = reinterpret_cast<uintptr_t>(pMap);
+				uintptr_t uAligned = (uMap + g_nHuge_Page_Size - 1) & ~(g_nHuge_Page_Size - 1);
+				if (uAligned > uMap)
+					munmap(pMap,uAligned - uMap);
+				if (uMap + nMap_Size > uAligned + nBytes)
+					munmap(reinterpret_cast<void *>(uAligned + nBytes),uMap + nMap_Size - (uAligned + nBytes));
+				pRet = reinterpret_cast<void *>(uAligned);
+				madvise(pRet,nBytes,MADV_HUGEPAGE); // failure is not fatal; the block is then backed by normal pages
+				if (i_iPolicy != XSTDTSL_NUMA_DEFAULT)
+					xstdtsl_numa_apply(pRet,nBytes,i_iPolicy,i_iNode);
+				iKind = XSTDTSL_BLOCK_MAPPED;
+			}
+		}
+#endif
+		if (pRet == nullptr)
+		{
+#ifdef __XSTDTSL_NUMA
+			if (i_iPolicy != XSTDTSL_NUMA_DEFAULT)
+			{
+				pRet = numa_map_alloc(i_nBytes,i_nAlignment,i_iPolicy,i_iNode);
+				iKind = XSTDTSL_BLOCK_NUMA;
+			}
+			else
+#endif
+			if (i_nAlignment <= alignof(std::max_align_t))
+				pRet = std::malloc(i_nBytes);
+			else
+			{
+				pRet = aligned_heap_alloc(i_nBytes,i_nAlignment);
+				iKind = XSTDTSL_BLOCK_ALIGNED;
+			}
+		}
+	}
+	if (o_piKind != nullptr)
+		*o_piKind = iKind;
+	return pRet;
+}
+
+void xstdtsl_block_free(void * i_pMemory, size_t i_nBytes, int i_iKind) noexcept
+{
+	if (i_pMemory != nullptr)
+	{
+#ifdef __XSTDTSL_HUGE_PAGES
+		if (i_iKind == XSTDTSL_BLOCK_MAPPED)
+			munmap(i_pMemory,(i_nBytes + g_nHuge_Page_Size - 1) & ~(g_nHuge_Page_Size - 1));
+		else
+#endif
+#ifdef __XSTDTSL_NUMA
+		if (i_iKind == XSTDTSL_BLOCK_NUMA)
+			numa_map_free(i_pMemory,i_nBytes);
+		else
+#endif
+		if (i_iKind == XSTDTSL_BLOCK_ALIGNED)
+			aligned_heap_free(i_pMemory);
+		else
+			std::free(i_pMemory);
+	}
+}
+
+unsigned int xstdtsl_get_detected_cpu_features(void) noexcept
+{
+	return g_cSystem_Data.m_uCPU_Features;
+}
+
+unsigned int xstdtsl_get_cpu_features(void) noexcept
+{
+	return cached_cpu_features() & g_cKernel_Dispatch.m_uFeature_Mask.load(std::memory_order_relaxed);
+}
+
+void xstdtsl_set_cpu_feature_mask(unsigned int i_uMask) noexcept
+{
+	g_cKernel_Dispatch.m_uFeature_Mask.store(i_uMask,std::memory_order_relaxed);
+	g_cKernel_Dispatch.select();
+}
+
+const xstdtsl_kernel_table * xstdtsl_get_kernel_table(void) noexcept
+{
+	const xstdtsl_kernel_table * pRet = g_cKernel_Dispatch.m_pTable.load(std::memory_order_acquire);
+	if (pRet == nullptr)
+		pRet = g_cKernel_Dispatch.select();
+	return pRet;
+}
+
 #ifdef __XSTDTSL_WINDOWS
 #undef __XSTDTSL_WINDOWS
 #endif
+#ifdef __XSTDTSL_X86
+#undef __XSTDTSL_X86
+#endif
+#ifdef __XSTDTSL_NUMA
+#undef __XSTDTSL_NUMA
+#endif
+#ifdef __XSTDTSL_HUGE_PAGES
+#undef __XSTDTSL_HUGE_PAGES
+#endif
 
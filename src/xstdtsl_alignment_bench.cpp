@@ -0,0 +1,87 @@
+#include <xstdtsl_safe_vector>
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+
+///
+/// a structure that fills one cache line when aligned
+///
+struct line_record
+{
+	int64_t	m_lliValues[8];
+};
+
+///
+/// time repeated passes of a function over a buffer
+/// \returns the throughput in GB/s
+///
+template <class F> double throughput(size_t i_nBytes, size_t i_nPasses, F i_fnPass)
+{
+	auto tStart = std::chrono::steady_clock::now();
+	for (size_t nI = 0; nI < i_nPasses; nI++)
+		i_fnPass();
+	double dSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+	return (double)i_nBytes * (double)i_nPasses / dSeconds * 1.0e-9;
+}
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	size_t nTotal_Bytes = 256 * 1024 * 1024;
+	if (i_nNum_Params > 1)
+		nTotal_Bytes = std::strtoul(i_pParams[1],nullptr,10);
+	const size_t lpnSizes[] = {16 * 1024, 256 * 1024, 64 * 1024 * 1024};
+	const size_t lpnOffsets[] = {0, 4, 16, 32};
+	const xstdtsl_kernel_table * pKernels = xstdtsl_get_kernel_table();
+	volatile size_t nSink = 0;
+
+	std::cout << "--------------=============== aligned vs unaligned kernel benchmark ===============--------------" << std::endl;
+	std::cout << "cache line size: " << xstdtsl_get_cache_line_size() << " kernel level: " << pKernels->uFeature_Level << std::endl;
+	std::cout << "buffer bytes\toffset\tfind_32 GB/s\tfind_64 GB/s\t64-byte record sum GB/s" << std::endl;
+	for (size_t nBytes : lpnSizes)
+	{
+		size_t nPasses = nTotal_Bytes / nBytes;
+		if (nPasses == 0)
+			nPasses = 1;
+		int iKind;
+		char * pBase = reinterpret_cast<char *>(xstdtsl_block_alloc_aligned(nBytes + 64,64,XSTDTSL_NUMA_DEFAULT,0,&iKind));
+		std::memset(pBase,1,nBytes + 64);
+		for (size_t nOffset : lpnOffsets)
+		{
+			char * pData = pBase + nOffset;
+			double dFind_32 = throughput(nBytes,nPasses,[&]() { nSink = nSink + pKernels->find_32(pData,nBytes / 4,0); });
+			double dFind_64 = throughput(nBytes,nPasses,[&]() { nSink = nSink + pKernels->find_64(pData,nBytes / 8,0); });
+			const line_record * pRecords = reinterpret_cast<const line_record *>(pData);
+			size_t nRecords = nBytes / sizeof(line_record);
+			double dRecords = throughput(nBytes,nPasses,[&]()
+			{
+				int64_t iSum = 0;
+				for (size_t nI = 0; nI < nRecords; nI++)
+					iSum += pRecords[nI].m_lliValues[0] + pRecords[nI].m_lliValues[7];
+				nSink = nSink + (size_t)iSum;
+			});
+			std::cout << nBytes << "\t" << nOffset << "\t" << dFind_32 << "\t" << dFind_64 << "\t" << dRecords << std::endl;
+		}
+		xstdtsl_block_free(pBase,nBytes + 64,iKind);
+	}
+
+	std::cout << "--------------=============== safe_vector find by alignment ===============--------------" << std::endl;
+	std::cout << "elements\tcache line aligned GB/s\t16-byte aligned GB/s" << std::endl;
+	for (size_t nBytes : lpnSizes)
+	{
+		size_t nCount = nBytes / sizeof(uint32_t);
+		size_t nPasses = nTotal_Bytes / nBytes;
+		if (nPasses == 0)
+			nPasses = 1;
+		xstdtsl::safe_vector<uint32_t> cAligned;
+		cAligned.resize(nCount,1);
+		// the block before this change: malloc alignment, which for large blocks is 16 bytes past a page boundary
+		xstdtsl::aligned_safe_vector<uint32_t,16> cMalloc_Aligned;
+		cMalloc_Aligned.resize(nCount,1);
+		double dAligned = throughput(nBytes,nPasses,[&]() { nSink = nSink + cAligned.find(0); });
+		double dMalloc = throughput(nBytes,nPasses,[&]() { nSink = nSink + cMalloc_Aligned.find(0); });
+		std::cout << nCount << "\t" << dAligned << "\t" << dMalloc << std::endl;
+	}
+	return 0;
+}
@@ -0,0 +1,85 @@
+#include <xstdtsl_safe_vector>
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <memory_resource>
+#include <cstdlib>
+#include <cstdint>
+
+///
+/// simulate a request: build several vectors of differing sizes element by element, then read them back
+/// \returns a checksum of the vectors
+///
+template <class V, class M> int64_t request(size_t i_nVectors, size_t i_nElements, M i_fnMake)
+{
+	int64_t iRet = 0;
+	std::vector<V *> vVectors;
+	for (size_t nI = 0; nI < i_nVectors; nI++)
+	{
+		V * pVector = i_fnMake();
+		size_t nCount = i_nElements / 2 + (nI * 37) % i_nElements;
+		for (size_t nJ = 0; nJ < nCount; nJ++)
+			pVector->push_back((int64_t)(nI + nJ));
+		vVectors.push_back(pVector);
+	}
+	for (V * pVector : vVectors)
+	{
+		iRet += pVector->load(pVector->size() - 1);
+		delete pVector;
+	}
+	return iRet;
+}
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	size_t nRequests = 20000;
+	size_t nVectors = 16;
+	if (i_nNum_Params > 1)
+		nRequests = std::strtoul(i_pParams[1],nullptr,10);
+	if (i_nNum_Params > 2)
+		nVectors = std::strtoul(i_pParams[2],nullptr,10);
+
+	std::cout << "--------------=============== request-scoped allocation benchmark ===============--------------" << std::endl;
+	std::cout << "requests: " << nRequests << " vectors per request: " << nVectors << std::endl;
+	std::cout << "elements per vector\tdefault us/request\tstd::allocator us/request\tarena us/request\tpmr monotonic us/request" << std::endl;
+	int64_t iCheck = 0;
+	for (size_t nElements = 16; nElements <= 4096; nElements *= 4)
+	{
+		typedef xstdtsl::safe_vector<int64_t> default_vector;
+		auto tStart = std::chrono::steady_clock::now();
+		for (size_t nR = 0; nR < nRequests; nR++)
+			iCheck += request<default_vector>(nVectors,nElements,[]() { return new default_vector; });
+		double dDefault = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+
+		typedef xstdtsl::safe_vector<int64_t,std::allocator<int64_t>> std_vector;
+		tStart = std::chrono::steady_clock::now();
+		for (size_t nR = 0; nR < nRequests; nR++)
+			iCheck += request<std_vector>(nVectors,nElements,[]() { return new std_vector; });
+		double dStd = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+
+		typedef xstdtsl::safe_vector<int64_t,xstdtsl::arena_allocator<int64_t>> arena_vector;
+		xstdtsl::arena cArena(256 * 1024);
+		tStart = std::chrono::steady_clock::now();
+		for (size_t nR = 0; nR < nRequests; nR++)
+		{
+			iCheck += request<arena_vector>(nVectors,nElements,[&cArena]() { return new arena_vector(xstdtsl::arena_allocator<int64_t>(cArena)); });
+			cArena.reset();
+		}
+		double dArena = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+
+		typedef xstdtsl::pmr::safe_vector<int64_t> pmr_vector;
+		tStart = std::chrono::steady_clock::now();
+		for (size_t nR = 0; nR < nRequests; nR++)
+		{
+			std::pmr::monotonic_buffer_resource cResource(256 * 1024);
+			iCheck += request<pmr_vector>(nVectors,nElements,[&cResource]() { return new pmr_vector(std::pmr::polymorphic_allocator<int64_t>(&cResource)); });
+		}
+		double dPmr = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+
+		double dScale = 1.0e6 / (double)nRequests;
+		std::cout << nElements << "\t" << dDefault * dScale << "\t" << dStd * dScale << "\t" << dArena * dScale << "\t" << dPmr * dScale << std::endl;
+	}
+	if (iCheck == 1)
+		std::cout << std::endl;
+	return 0;
+}
@@ -0,0 +1,76 @@
+#include <xstdtsl_safe_vector>
+#include <xstdtsl_safe_append_vector>
+#include <thread>
+#include <atomic>
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <cstdlib>
+#include <cstdint>
+
+///
+/// run a number of producer threads that each append a fixed number of elements
+/// \returns the elapsed time in seconds
+///
+template <class F> double run_producers(size_t i_nThreads, F i_fnWork)
+{
+	std::atomic<bool> bGo(false);
+	std::vector<std::thread> vThreads;
+	for (size_t nI = 0; nI < i_nThreads; nI++)
+	{
+		vThreads.emplace_back([&bGo,&i_fnWork,nI]()
+		{
+			while (!bGo.load())
+				std::this_thread::yield();
+			i_fnWork(nI);
+		});
+	}
+	auto tStart = std::chrono::steady_clock::now();
+	bGo = true;
+	for (auto & cThread : vThreads)
+		cThread.join();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+}
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	size_t nMax_Threads = 64;
+	size_t nAppends = 200000;
+	if (i_nNum_Params > 1)
+		nMax_Threads = std::strtoul(i_pParams[1],nullptr,10);
+	if (i_nNum_Params > 2)
+		nAppends = std::strtoul(i_pParams[2],nullptr,10);
+
+	std::cout << "--------------=============== concurrent append scaling benchmark ===============--------------" << std::endl;
+	std::cout << "appends per thread: " << nAppends << std::endl;
+	std::cout << "threads\tsafe_vector Mappends/s\tsafe_append_vector Mappends/s\tsafe_append_vector (presized) Mappends/s" << std::endl;
+	for (size_t nThreads = 1; nThreads <= nMax_Threads; nThreads *= 2)
+	{
+		xstdtsl::safe_vector<int64_t> cLocked;
+		double dLocked = run_producers(nThreads,[&cLocked,nAppends](size_t i_nThread)
+		{
+			for (size_t nI = 0; nI < nAppends; nI++)
+				cLocked.push_back((int64_t)(i_nThread * nAppends + nI));
+		});
+
+		xstdtsl::safe_append_vector<int64_t> cAppend;
+		double dAppend = run_producers(nThreads,[&cAppend,nAppends](size_t i_nThread)
+		{
+			for (size_t nI = 0; nI < nAppends; nI++)
+				cAppend.push_back((int64_t)(i_nThread * nAppends + nI));
+		});
+
+		xstdtsl::safe_append_vector<int64_t> cPresized(nThreads * nAppends);
+		double dPresized = run_producers(nThreads,[&cPresized,nAppends](size_t i_nThread)
+		{
+			for (size_t nI = 0; nI < nAppends; nI++)
+				cPresized.push_back((int64_t)(i_nThread * nAppends + nI));
+		});
+		if (cLocked.size() != cAppend.size() || cAppend.size() != cPresized.size())
+			std::cout << "size mismatch: " << cLocked.size() << " " << cAppend.size() << " " << cPresized.size() << std::endl;
+
+		double dOps = (double)nThreads * (double)nAppends * 1.0e-6;
+		std::cout << nThreads << "\t" << dOps / dLocked << "\t" << dOps / dAppend << "\t" << dOps / dPresized << std::endl;
+	}
+	return 0;
+}
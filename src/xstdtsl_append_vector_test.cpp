@@ -0,0 +1,229 @@
+#include <xstdtsl_safe_append_vector>
+#include <thread>
+#include <atomic>
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+///
+/// element type that tracks live instances and whose constructor throws for negative values
+///
+class throws_on_negative
+{
+public:
+	static int g_iLive; ///< number of instances alive
+	int m_iValue; ///< the value held
+
+	throws_on_negative(void) noexcept : m_iValue(0) { g_iLive++; }
+	explicit throws_on_negative(int i_iValue) noexcept(false) : m_iValue(i_iValue)
+	{
+		if (i_iValue < 0)
+			throw std::runtime_error("negative");
+		g_iLive++;
+	}
+	throws_on_negative(const throws_on_negative & i_cRHO) noexcept : m_iValue(i_cRHO.m_iValue) { g_iLive++; }
+	throws_on_negative & operator =(const throws_on_negative & i_cRHO) noexcept { m_iValue = i_cRHO.m_iValue; return *this; }
+	bool operator ==(const throws_on_negative & i_cRHO) const noexcept { return m_iValue == i_cRHO.m_iValue; }
+	~throws_on_negative(void) noexcept { g_iLive--; }
+};
+int throws_on_negative::g_iLive = 0;
+///
+/// element type that tracks live instances and whose copy constructor throws while g_bThrow is set; it has no move constructor, so growth copies it
+///
+class throws_on_copy
+{
+public:
+	static int g_iLive; ///< number of instances alive
+	static bool g_bThrow; ///< copies throw while set
+	int m_iValue; ///< the value held
+
+	explicit throws_on_copy(int i_iValue = 0) noexcept : m_iValue(i_iValue) { g_iLive++; }
+	throws_on_copy(const throws_on_copy & i_cRHO) noexcept(false) : m_iValue(i_cRHO.m_iValue)
+	{
+		if (g_bThrow)
+			throw std::runtime_error("copy");
+		g_iLive++;
+	}
+	throws_on_copy & operator =(const throws_on_copy & i_cRHO) noexcept { m_iValue = i_cRHO.m_iValue; return *this; }
+	~throws_on_copy(void) noexcept { g_iLive--; }
+};
+int throws_on_copy::g_iLive = 0;
+bool throws_on_copy::g_bThrow = false;
+
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	std::cout << "--------------=============== safe_append_vector tests ===============--------------" << std::endl;
+	{
+		std::cout << "instantiate empty int vector" << std::endl;
+		xstdtsl::safe_append_vector<int> cSAV;
+		assert(cSAV.empty());
+		assert(cSAV.capacity() == 0);
+		std::cout << "push_back from a single thread" << std::endl;
+		for (int iI = 0; iI < 1000; iI++)
+			assert(cSAV.push_back(iI) == (size_t)iI);
+		assert(cSAV.size() == 1000);
+		assert(cSAV.reserved() == 1000);
+		assert(cSAV.capacity() >= 1000);
+		std::cout << "confirm contents" << std::endl;
+		for (int iI = 0; iI < 1000; iI++)
+		{
+			assert(cSAV.is_published(iI));
+			assert(cSAV.load(iI) == iI);
+		}
+		assert(!cSAV.is_published(1000));
+		assert(cSAV.load(1000) == 0);
+		std::cout << "find, load_range and store" << std::endl;
+		assert(cSAV.find(500) == 500);
+		assert(cSAV.find(5,6) == 1000);
+		std::vector<int> vOut(10);
+		assert(cSAV.load_range(995,10,vOut.data()) == 5);
+		assert(vOut[4] == 999);
+		cSAV.store(3,-3);
+		assert(cSAV.load(3) == -3);
+		std::cout << "clear keeps the capacity" << std::endl;
+		size_t nCapacity = cSAV.capacity();
+		cSAV.clear();
+		assert(cSAV.empty());
+		assert(cSAV.reserved() == 0);
+		assert(cSAV.capacity() == nCapacity);
+		cSAV.push_back(7);
+		assert(cSAV.load(0) == 7);
+	}
+	{
+		std::cout << "append strings with an initial capacity" << std::endl;
+		xstdtsl::safe_append_vector<std::string> cSAV(4);
+		assert(cSAV.capacity() == 4);
+		for (int iI = 0; iI < 100; iI++)
+			cSAV.emplace_back(3,(char)('a' + iI % 26));
+		assert(cSAV.size() == 100);
+		assert(cSAV.load(27) == "bbb");
+		assert(cSAV.find(std::string("ccc")) == 2);
+	}
+	{
+		std::cout << "a throwing constructor leaves a failed slot that the watermark steps over" << std::endl;
+		{
+			xstdtsl::safe_append_vector<throws_on_negative> cSAV(2);
+			cSAV.emplace_back(1);
+			bool bThrown = false;
+			try
+			{
+				cSAV.emplace_back(-1);
+			}
+			catch (const std::runtime_error &)
+			{
+				bThrown = true;
+			}
+			assert(bThrown);
+			assert(throws_on_negative::g_iLive == 1);
+			cSAV.emplace_back(3);
+			cSAV.emplace_back(4);
+			assert(cSAV.size() == 4);
+			assert(cSAV.published() == 3);
+			assert(cSAV.capacity() >= 4);
+			assert(!cSAV.is_published(1) && cSAV.is_published(2));
+			assert(cSAV.load(1).m_iValue == 0 && cSAV.load(3).m_iValue == 4);
+			assert(cSAV.find(throws_on_negative(3)) == 2);
+			assert(cSAV.find(throws_on_negative(0)) == 4);
+			std::vector<throws_on_negative> vOut(4);
+			assert(cSAV.load_range(0,4,vOut.data()) == 4);
+			assert(vOut[0].m_iValue == 1 && vOut[1].m_iValue == 0 && vOut[2].m_iValue == 3);
+			cSAV.store(1,throws_on_negative(9));
+			assert(!cSAV.is_published(1));
+			cSAV.reserve(64);
+			assert(cSAV.load(2).m_iValue == 3);
+			cSAV.clear();
+			assert(cSAV.empty() && cSAV.published() == 0 && throws_on_negative::g_iLive == 4);
+		}
+		assert(throws_on_negative::g_iLive == 0);
+		std::cout << "a growth that throws leaves the elements intact and the abandoned slot failed" << std::endl;
+		{
+			xstdtsl::safe_append_vector<throws_on_copy> cSAV(2);
+			cSAV.emplace_back(1);
+			cSAV.emplace_back(2);
+			throws_on_copy::g_bThrow = true;
+			bool bThrown = false;
+			try
+			{
+				cSAV.emplace_back(3);
+			}
+			catch (const std::runtime_error &)
+			{
+				bThrown = true;
+			}
+			throws_on_copy::g_bThrow = false;
+			assert(bThrown);
+			assert(throws_on_copy::g_iLive == 2);
+			assert(cSAV.capacity() == 2 && cSAV.size() == 2);
+			assert(cSAV.load(0).m_iValue == 1 && cSAV.load(1).m_iValue == 2);
+			cSAV.emplace_back(4);
+			assert(cSAV.size() == 4);
+			assert(!cSAV.is_published(2) && cSAV.is_published(3));
+			assert(cSAV.load(1).m_iValue == 2 && cSAV.load(3).m_iValue == 4);
+			assert(cSAV.published() == 3);
+			assert(throws_on_copy::g_iLive == 3);
+		}
+		assert(throws_on_copy::g_iLive == 0);
+		std::cout << "stale memory in a failed slot of an integral type is not found" << std::endl;
+		xstdtsl::safe_append_vector<int64_t> cSAV(4);
+		struct throwing_source
+		{
+			operator int64_t(void) const { throw std::runtime_error("source"); }
+		};
+		cSAV.push_back(5);
+		cSAV.push_back(6);
+		cSAV.clear();
+		cSAV.push_back(5);
+		try
+		{
+			cSAV.emplace_back(throwing_source());
+		}
+		catch (const std::runtime_error &)
+		{
+		}
+		cSAV.push_back(6);
+		assert(cSAV.size() == 3 && !cSAV.is_published(1));
+		assert(cSAV.find(6) == 2);
+	}
+	{
+		std::cout << "append from 8 threads concurrently" << std::endl;
+		xstdtsl::safe_append_vector<int64_t> cSAV;
+		const int64_t iPer_Thread = 20000;
+		std::vector<std::thread> vThreads;
+		for (int64_t iT = 0; iT < 8; iT++)
+		{
+			vThreads.emplace_back([&cSAV,iT,iPer_Thread]()
+			{
+				for (int64_t iI = 0; iI < iPer_Thread; iI++)
+					cSAV.push_back(iT * iPer_Thread + iI);
+			});
+		}
+		std::thread cReader([&cSAV]()
+		{
+			for (int iI = 0; iI < 1000; iI++)
+			{
+				size_t nSize = cSAV.size();
+				for (size_t nJ = 0; nJ < nSize; nJ += 101)
+					assert(cSAV.is_published(nJ));
+			}
+		});
+		for (auto & cThread : vThreads)
+			cThread.join();
+		cReader.join();
+		std::cout << "confirm every value is present exactly once" << std::endl;
+		assert(cSAV.size() == 8 * iPer_Thread);
+		assert(cSAV.published() == 8 * iPer_Thread);
+		std::vector<int64_t> vAll(8 * iPer_Thread);
+		assert(cSAV.load_range(0,vAll.size(),vAll.data()) == vAll.size());
+		std::vector<bool> vSeen(vAll.size(),false);
+		for (int64_t iValue : vAll)
+		{
+			assert(iValue >= 0 && iValue < (int64_t)vAll.size());
+			assert(!vSeen[iValue]);
+			vSeen[iValue] = true;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,99 @@
+#include <xstdtsl_safe_flat_map>
+#include <xstdtsl_safe_rb_tree>
+#include <xstdtsl_safe_map>
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <cstdint>
+#include <vector>
+
+///
+/// time a function
+/// \returns the elapsed time in seconds
+///
+template <class F> double time_it(F i_fnFunction)
+{
+	auto tStart = std::chrono::steady_clock::now();
+	i_fnFunction();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+}
+
+///
+/// time inserting keys in a given order, looking up every key in a scattered order through the locking interface, and looking them up again under one read control
+///
+template <class C, class I, class R> void compare(const char * i_pContainer, const char * i_pOrder, const std::vector<int64_t> & i_cInsert_Order, const std::vector<int64_t> & i_cKeys, size_t i_nRounds, I i_fnInsert, R i_fnRead)
+{
+	size_t nKeys = i_cKeys.size();
+	C cContainer;
+	double dInsert = time_it([&]()
+	{
+		for (size_t nI = 0; nI < nKeys; nI++)
+			i_fnInsert(cContainer,i_cInsert_Order[nI]);
+	});
+	size_t nFound = 0;
+	double dLookup = time_it([&]()
+	{
+		for (size_t nRound = 0; nRound < i_nRounds; nRound++)
+		{
+			for (size_t nI = 0; nI < nKeys; nI++)
+				nFound += cContainer.has_key(i_cKeys[(nI * 7) % nKeys] + (int64_t)(nRound & 1)) ? 1 : 0;
+		}
+	});
+	double dControl = time_it([&]()
+	{
+		typename C::read_control cRead(cContainer);
+		for (size_t nRound = 0; nRound < i_nRounds; nRound++)
+		{
+			for (size_t nI = 0; nI < nKeys; nI++)
+				nFound += i_fnRead(cRead,i_cKeys[(nI * 7) % nKeys] + (int64_t)(nRound & 1));
+		}
+	});
+	double dLookups = (double)(nKeys * i_nRounds);
+	std::cout << i_pContainer << "\t" << i_pOrder << "\t" << nKeys << "\t" << dInsert * 1.0e9 / nKeys << "\t" << dLookup * 1.0e9 / dLookups << "\t" << dControl * 1.0e9 / dLookups << "\t" << nFound << std::endl;
+}
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	size_t nMax_Keys = 256 * 1024;
+	size_t nLookups = 4 * 1024 * 1024;
+	if (i_nNum_Params > 1)
+		nMax_Keys = std::strtoul(i_pParams[1],nullptr,10);
+	if (i_nNum_Params > 2)
+		nLookups = std::strtoul(i_pParams[2],nullptr,10);
+
+	std::cout << "--------------=============== safe_flat_set / safe_flat_map benchmark ===============--------------" << std::endl;
+	std::cout << "keys are even, so alternate lookup rounds hit and miss. the trees are filled in ascending order, as safe_rb_tree and safe_map lose keys when filled in a scattered order" << std::endl;
+	std::cout << "container\tinsert order\tkeys\tinsert ns\thas_key ns\tread_control has_key ns\tfound" << std::endl;
+	for (size_t nKeys = 1024; nKeys <= nMax_Keys; nKeys *= 4)
+	{
+		std::vector<int64_t> cKeys(nKeys);
+		std::vector<int64_t> cAscending(nKeys);
+		for (size_t nI = 0; nI < nKeys; nI++)
+		{
+			cKeys[nI] = (int64_t)(((nI * 2654435761ULL) % nKeys) * 2);
+			cAscending[nI] = (int64_t)(nI * 2);
+		}
+		size_t nRounds = nLookups / nKeys;
+		if (nRounds < 2)
+			nRounds = 2;
+		compare<xstdtsl::safe_rb_tree<int64_t>>("safe_rb_tree","ascending",cAscending,cKeys,nRounds,
+			[](xstdtsl::safe_rb_tree<int64_t> & io_cTree, int64_t i_iKey) { io_cTree.insert(i_iKey); },
+			[](xstdtsl::safe_rb_tree<int64_t>::read_control & i_cRead, int64_t i_iKey) { return i_cRead.has_key(i_iKey) ? 1 : 0; });
+		compare<xstdtsl::safe_flat_set<int64_t>>("safe_flat_set","ascending",cAscending,cKeys,nRounds,
+			[](xstdtsl::safe_flat_set<int64_t> & io_cSet, int64_t i_iKey) { io_cSet.insert(i_iKey); },
+			[](xstdtsl::safe_flat_set<int64_t>::read_control & i_cRead, int64_t i_iKey) { return i_cRead.has_key(i_iKey) ? 1 : 0; });
+		compare<xstdtsl::safe_flat_set<int64_t>>("safe_flat_set","scattered",cKeys,cKeys,nRounds,
+			[](xstdtsl::safe_flat_set<int64_t> & io_cSet, int64_t i_iKey) { io_cSet.insert(i_iKey); },
+			[](xstdtsl::safe_flat_set<int64_t>::read_control & i_cRead, int64_t i_iKey) { return i_cRead.has_key(i_iKey) ? 1 : 0; });
+		compare<xstdtsl::safe_map<int64_t,int64_t>>("safe_map","ascending",cAscending,cKeys,nRounds,
+			[](xstdtsl::safe_map<int64_t,int64_t> & io_cMap, int64_t i_iKey) { io_cMap.insert(i_iKey,i_iKey); },
+			[](xstdtsl::safe_map<int64_t,int64_t>::read_control & i_cRead, int64_t i_iKey) { return i_cRead.has_key(i_iKey) ? 1 : 0; });
+		compare<xstdtsl::safe_flat_map<int64_t,int64_t>>("safe_flat_map","ascending",cAscending,cKeys,nRounds,
+			[](xstdtsl::safe_flat_map<int64_t,int64_t> & io_cMap, int64_t i_iKey) { io_cMap.insert(i_iKey,i_iKey); },
+			[](xstdtsl::safe_flat_map<int64_t,int64_t>::read_control & i_cRead, int64_t i_iKey) { return i_cRead.has_key(i_iKey) ? 1 : 0; });
+		compare<xstdtsl::safe_flat_map<int64_t,int64_t>>("safe_flat_map","scattered",cKeys,cKeys,nRounds,
+			[](xstdtsl::safe_flat_map<int64_t,int64_t> & io_cMap, int64_t i_iKey) { io_cMap.insert(i_iKey,i_iKey); },
+			[](xstdtsl::safe_flat_map<int64_t,int64_t>::read_control & i_cRead, int64_t i_iKey) { return i_cRead.has_key(i_iKey) ? 1 : 0; });
+	}
+	return 0;
+}
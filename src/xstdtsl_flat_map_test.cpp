@@ -0,0 +1,244 @@
+#include <xstdtsl_safe_flat_map>
+#include <thread>
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <set>
+#include <map>
+#include <stdexcept>
+
+///
+/// key type whose operator < throws while a flag is set
+///
+struct fragile_key
+{
+	static bool g_bThrow; ///< throw from operator <
+	int64_t m_iKey; ///< the key
+
+	fragile_key(void) noexcept : m_iKey(0) {}
+	fragile_key(int64_t i_iKey) noexcept : m_iKey(i_iKey) {}
+	bool operator <(const fragile_key & i_cRHO) const
+	{
+		if (g_bThrow)
+			throw std::runtime_error("compare");
+		return m_iKey < i_cRHO.m_iKey;
+	}
+	bool operator ==(const fragile_key & i_cRHO) const noexcept { return m_iKey == i_cRHO.m_iKey; }
+};
+bool fragile_key::g_bThrow = false;
+
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	std::cout << "--------------=============== safe_flat_set / safe_flat_map tests ===============--------------" << std::endl;
+	{
+		std::cout << "instantiate empty set of int64_t" << std::endl;
+		xstdtsl::safe_flat_set<int64_t> cSet;
+		assert(cSet.empty() && cSet.size() == 0);
+		assert(!cSet.has_key(0));
+		cSet.erase(0);
+		cSet.flush();
+		std::cout << "insert keys in a scattered order, across many merges" << std::endl;
+		std::set<int64_t> cReference;
+		for (int64_t iI = 0; iI < 5000; iI++)
+		{
+			int64_t iKey = (iI * 7919) % 10007;
+			cSet.insert(iKey);
+			cReference.insert(iKey);
+			assert(cSet.has_key(iKey));
+		}
+		cSet.insert(7919);
+		assert(cSet.size() == cReference.size());
+		std::cout << "confirm every key and the keys between them" << std::endl;
+		for (int64_t iKey = -1; iKey <= 10008; iKey++)
+			assert(cSet.has_key(iKey) == (cReference.count(iKey) == 1));
+		assert(cSet.load(7919) == 7919 && cSet.load(-5) == 0);
+		std::cout << "iterate in order with keys still pending" << std::endl;
+		cSet.insert(-3);
+		cSet.insert(20000);
+		cSet.insert(5);
+		cReference.insert(-3);
+		cReference.insert(20000);
+		cReference.insert(5);
+		{
+			std::vector<int64_t> cKeys;
+			cSet.for_each([&cKeys](const int64_t & i_iKey) { cKeys.push_back(i_iKey); });
+			assert(cKeys == std::vector<int64_t>(cReference.begin(),cReference.end()));
+		}
+		std::cout << "erase sorted and pending keys" << std::endl;
+		for (int64_t iKey = 0; iKey < 10007; iKey += 3)
+		{
+			cSet.erase(iKey);
+			cReference.erase(iKey);
+		}
+		cSet.erase(20000);
+		cReference.erase(20000);
+		cSet.erase(123456);
+		assert(cSet.size() == cReference.size());
+		for (int64_t iKey = -5; iKey <= 20001; iKey++)
+			assert(cSet.has_key(iKey) == (cReference.count(iKey) == 1));
+		std::cout << "flush and confirm the order" << std::endl;
+		cSet.flush();
+		{
+			std::vector<int64_t> cKeys;
+			cSet.for_each([&cKeys](const int64_t & i_iKey) { cKeys.push_back(i_iKey); });
+			assert(cKeys == std::vector<int64_t>(cReference.begin(),cReference.end()));
+		}
+		std::cout << "copy and clear" << std::endl;
+		xstdtsl::safe_flat_set<int64_t> cCopy(cSet);
+		cSet.clear();
+		assert(cSet.empty() && !cSet.has_key(1));
+		assert(cCopy.size() == cReference.size() && !cCopy.has_key(3));
+		for (int64_t iKey : cReference)
+			assert(cCopy.has_key(iKey));
+		cSet = cCopy;
+		assert(cSet.size() == cReference.size() && cSet.has_key(-3));
+	}
+	{
+		std::cout << "search every size of sorted run around every key" << std::endl;
+		for (int32_t iSize = 0; iSize < 200; iSize++)
+		{
+			xstdtsl::safe_flat_set<int32_t> cSet;
+			for (int32_t iI = iSize - 1; iI >= 0; iI--)
+				cSet.insert(iI * 2);
+			cSet.flush();
+			for (int32_t iKey = -1; iKey <= iSize * 2; iKey++)
+				assert(cSet.has_key(iKey) == (iKey >= 0 && iKey % 2 == 0 && iKey < iSize * 2));
+		}
+	}
+	{
+		std::cout << "set of strings through the controls" << std::endl;
+		xstdtsl::safe_flat_set<std::string> cSet;
+		{
+			xstdtsl::safe_flat_set<std::string>::write_control cWrite(cSet);
+			for (int iI = 0; iI < 1000; iI++)
+				cWrite.insert(std::to_string(iI));
+			cWrite.insert("500");
+			cWrite.store("42");
+			cWrite.erase("7");
+			assert(cWrite.size() == 999);
+		}
+		{
+			xstdtsl::safe_flat_set<std::string>::read_control cRead(cSet);
+			assert(cRead.has_key("999") && cRead.has_key("0") && !cRead.has_key("7") && !cRead.has_key("1000"));
+			assert(cRead.load("42") == "42" && cRead.load("x").empty());
+			std::string sPrevious;
+			size_t nCount = 0;
+			cRead.for_each([&sPrevious,&nCount](const std::string & i_sKey)
+			{
+				assert(nCount == 0 || sPrevious < i_sKey);
+				sPrevious = i_sKey;
+				nCount++;
+			});
+			assert(nCount == 999);
+		}
+	}
+	{
+		std::cout << "map of int32_t to std::string" << std::endl;
+		xstdtsl::safe_flat_map<int32_t,std::string> cMap;
+		std::map<int32_t,std::string> cReference;
+		for (int32_t iI = 0; iI < 3000; iI++)
+		{
+			int32_t iKey = (iI * 389) % 3001;
+			cMap.insert(iKey,std::to_string(iKey));
+			cReference[iKey] = std::to_string(iKey);
+		}
+		cMap.insert(389,"ignored");
+		assert(cMap.size() == cReference.size());
+		assert(cMap.at(389) == "389" && cMap.load(389) == "389");
+		assert(cMap.at(-1).empty() && !cMap.has_key(-1));
+		std::cout << "store replaces values and inserts new keys" << std::endl;
+		cMap.store(389,"changed");
+		cMap.store(5000,"new");
+		cReference[389] = "changed";
+		cReference[5000] = "new";
+		assert(cMap.at(389) == "changed" && cMap.at(5000) == "new");
+		std::cout << "erase keys and confirm values follow their keys" << std::endl;
+		for (int32_t iKey = 0; iKey < 3001; iKey += 5)
+		{
+			cMap.erase(iKey);
+			cReference.erase(iKey);
+		}
+		assert(cMap.size() == cReference.size());
+		for (int32_t iKey = -1; iKey < 5002; iKey++)
+		{
+			auto cFound = cReference.find(iKey);
+			assert(cMap.has_key(iKey) == (cFound != cReference.end()));
+			assert(cMap.at(iKey) == (cFound != cReference.end() ? cFound->second : std::string()));
+		}
+		std::cout << "iterate keys and values in order" << std::endl;
+		{
+			xstdtsl::safe_flat_map<int32_t,std::string>::read_control cRead(cMap);
+			auto cIter = cReference.begin();
+			cRead.for_each([&cIter](const int32_t & i_iKey, const std::string & i_sValue)
+			{
+				assert(i_iKey == cIter->first && i_sValue == cIter->second);
+				++cIter;
+			});
+			assert(cIter == cReference.end());
+		}
+		std::cout << "write control and copy" << std::endl;
+		{
+			xstdtsl::safe_flat_map<int32_t,std::string>::write_control cWrite(cMap);
+			cWrite.insert(-10,"minus ten");
+			cWrite.store(-10,"minus ten again");
+			cWrite.erase(389);
+			cWrite.flush();
+			assert(cWrite.at(-10) == "minus ten again" && !cWrite.has_key(389));
+		}
+		xstdtsl::safe_flat_map<int32_t,std::string> cCopy(cMap);
+		cMap.clear();
+		assert(cMap.empty());
+		assert(cCopy.at(-10) == "minus ten again" && cCopy.at(1) == "1" && !cCopy.has_key(5));
+	}
+	{
+		std::cout << "a merge that throws leaves the pending run within its capacity" << std::endl;
+		xstdtsl::safe_flat_set<fragile_key> cSet;
+		size_t nPending = xstdtsl::safe_flat_set<fragile_key>::g_nPending_Capacity;
+		for (size_t nI = 0; nI < nPending; nI++)
+			cSet.insert(fragile_key((int64_t)(nPending - nI)));
+		fragile_key::g_bThrow = true;
+		for (int iTry = 0; iTry < 2; iTry++)
+		{
+			bool bThrown = false;
+			try
+			{
+				cSet.insert(fragile_key(0));
+			}
+			catch (const std::runtime_error &)
+			{
+				bThrown = true;
+			}
+			assert(bThrown);
+			assert(cSet.size() == nPending);
+		}
+		fragile_key::g_bThrow = false;
+		cSet.insert(fragile_key(0));
+		assert(cSet.size() == nPending + 1);
+		int64_t iExpected = 0;
+		cSet.for_each([&iExpected](const fragile_key & i_cKey) { assert(i_cKey.m_iKey == iExpected); iExpected++; });
+		assert(iExpected == (int64_t)nPending + 1);
+	}
+	{
+		std::cout << "concurrent inserts and lookups" << std::endl;
+		xstdtsl::safe_flat_map<int64_t,int64_t> cMap;
+		std::thread cWriter([&cMap]()
+		{
+			for (int64_t iI = 0; iI < 20000; iI++)
+				cMap.insert(iI,iI * 3);
+		});
+		for (int iJ = 0; iJ < 20000; iJ++)
+		{
+			int64_t iKey = (iJ * 13) % 20000;
+			if (cMap.has_key(iKey))
+				assert(cMap.at(iKey) == iKey * 3);
+		}
+		cWriter.join();
+		assert(cMap.size() == 20000);
+		for (int64_t iI = 0; iI < 20000; iI += 7)
+			assert(cMap.at(iI) == iI * 3);
+	}
+	return 0;
+}
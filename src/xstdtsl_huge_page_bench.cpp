@@ -0,0 +1,120 @@
+#include <xstdtsl_safe_vector>
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#if defined __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#endif
+
+///
+/// a dTLB load miss counter for the calling thread; reports -1 where performance counters are unavailable
+///
+class dtlb_counter
+{
+private:
+	int m_iFD; ///< the perf event file descriptor; -1 if unavailable
+public:
+	dtlb_counter(void) : m_iFD(-1)
+	{
+#if defined __linux__
+		perf_event_attr cAttr;
+		std::memset(&cAttr,0,sizeof(cAttr));
+		cAttr.size = sizeof(cAttr);
+		cAttr.type = PERF_TYPE_HW_CACHE;
+		cAttr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+		cAttr.disabled = 1;
+		cAttr.exclude_kernel = 1;
+		cAttr.exclude_hv = 1;
+		m_iFD = (int)syscall(SYS_perf_event_open,&cAttr,0,-1,-1,0);
+#endif
+	}
+	~dtlb_counter(void)
+	{
+#if defined __linux__
+		if (m_iFD >= 0)
+			close(m_iFD);
+#endif
+	}
+	void start(void)
+	{
+#if defined __linux__
+		if (m_iFD >= 0)
+		{
+			ioctl(m_iFD,PERF_EVENT_IOC_RESET,0);
+			ioctl(m_iFD,PERF_EVENT_IOC_ENABLE,0);
+		}
+#endif
+	}
+	int64_t stop(void)
+	{
+		int64_t iRet = -1;
+#if defined __linux__
+		if (m_iFD >= 0)
+		{
+			ioctl(m_iFD,PERF_EVENT_IOC_DISABLE,0);
+			if (read(m_iFD,&iRet,sizeof(iRet)) != sizeof(iRet))
+				iRet = -1;
+		}
+#endif
+		return iRet;
+	}
+};
+
+///
+/// fill a vector and perform random loads from it
+///
+void run(const char * i_lpszName, size_t i_nElements, size_t i_nLoads)
+{
+	xstdtsl::safe_vector<uint64_t> cVector;
+	cVector.reserve(i_nElements);
+	for (size_t nI = 0; nI < i_nElements; nI++)
+		cVector.push_back(nI);
+
+	dtlb_counter cCounter;
+	uint64_t uState = 88172645463325252ULL;
+	uint64_t uSum = 0;
+	cCounter.start();
+	auto tStart = std::chrono::steady_clock::now();
+	for (size_t nI = 0; nI < i_nLoads; nI++)
+	{
+		uState ^= uState << 13;
+		uState ^= uState >> 7;
+		uState ^= uState << 17;
+		uSum += cVector.load(uState % i_nElements);
+	}
+	double dTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+	int64_t iMisses = cCounter.stop();
+	std::cout << i_lpszName << "\t" << (double)i_nLoads / dTime * 1.0e-6 << "\t";
+	if (iMisses >= 0)
+		std::cout << iMisses;
+	else
+		std::cout << "n/a";
+	std::cout << "\t(" << uSum << ")" << std::endl;
+}
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	size_t nMegabytes = 1024;
+	size_t nLoads = 20000000;
+	if (i_nNum_Params > 1)
+		nMegabytes = std::strtoul(i_pParams[1],nullptr,10);
+	if (i_nNum_Params > 2)
+		nLoads = std::strtoul(i_pParams[2],nullptr,10);
+	size_t nElements = nMegabytes * 1024 * 1024 / sizeof(uint64_t);
+
+	std::cout << "--------------=============== huge page random access benchmark ===============--------------" << std::endl;
+	std::cout << "vector size: " << nMegabytes << " MiB, random loads: " << nLoads << std::endl;
+	std::cout << "huge pages available: " << (xstdtsl_huge_pages_available() ? "yes" : "no") << std::endl;
+	std::cout << "backing\tMloads/s\tdTLB load misses" << std::endl;
+	size_t nThreshold = xstdtsl_get_huge_page_threshold();
+	xstdtsl_set_huge_page_threshold(0);
+	run("normal",nElements,nLoads);
+	xstdtsl_set_huge_page_threshold(nThreshold > 0 ? nThreshold : 2 * 1024 * 1024);
+	run("huge",nElements,nLoads);
+	return 0;
+}
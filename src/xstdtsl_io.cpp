@@ -0,0 +1,137 @@
+#if defined _WIN32 || defined _WIN64
+#define __XSTDTSL_WINDOWS
+#include <io.h>
+#include <errno.h>
+#else
+#include <unistd.h>
+#include <errno.h>
+#include <limits.h>
+#include <poll.h>
+#include <sys/uio.h>
+#endif
+#include <cstddef>
+#include <cstdint>
+#include <xstdtsl_system_C.h>
+
+#ifdef __XSTDTSL_WINDOWS
+static const size_t g_nMax_Transfer = 0x40000000; ///< the largest transfer passed to one _write or _read call
+#else
+#ifdef IOV_MAX
+static const size_t g_nMax_Buffers = IOV_MAX; ///< the most buffers passed to one writev call
+#else
+static const size_t g_nMax_Buffers = 16;
+#endif
+///
+/// wait until a non-blocking file can make progress
+/// \returns 0 on success; the system error code otherwise
+///
+static int wait_for_file(int i_iFile, short i_sEvents) noexcept
+{
+	int iRet = 0;
+	struct pollfd cPoll;
+	cPoll.fd = i_iFile;
+	cPoll.events = i_sEvents;
+	cPoll.revents = 0;
+	if (poll(&cPoll,1,-1) < 0 && errno != EINTR)
+		iRet = errno;
+	return iRet;
+}
+#endif
+
+int xstdtsl_fd_write(int i_iFile, const xstdtsl_io_buffer * i_pBuffers, size_t i_nBuffers) noexcept
+{
+	int iRet = 0;
+	size_t nBuffer = 0; // the buffer being written
+	size_t nOffset = 0; // the bytes of that buffer already written
+#ifdef __XSTDTSL_WINDOWS
+	while (iRet == 0 && nBuffer < i_nBuffers)
+	{
+		size_t nRemaining = i_pBuffers[nBuffer].nBytes - nOffset;
+		if (nRemaining == 0)
+		{
+			nBuffer++;
+			nOffset = 0;
+		}
+		else
+		{
+			unsigned int uCount = (unsigned int)(nRemaining < g_nMax_Transfer ? nRemaining : g_nMax_Transfer);
+			int iWritten = _write(i_iFile,static_cast<const char *>(i_pBuffers[nBuffer].pData) + nOffset,uCount);
+			if (iWritten < 0)
+				iRet = errno;
+			else
+				nOffset += (size_t)iWritten;
+		}
+	}
+#else
+	struct iovec cVectors[g_nMax_Buffers];
+	while (iRet == 0 && nBuffer < i_nBuffers)
+	{
+		// gather the unwritten part of as many buffers as one call accepts
+		int iCount = 0;
+		for (size_t nI = nBuffer; nI < i_nBuffers && (size_t)iCount < g_nMax_Buffers; nI++)
+		{
+			size_t nSkip = nI == nBuffer ? nOffset : 0;
+			if (i_pBuffers[nI].nBytes > nSkip)
+			{
+				cVectors[iCount].iov_base = const_cast<char *>(static_cast<const char *>(i_pBuffers[nI].pData) + nSkip);
+				cVectors[iCount].iov_len = i_pBuffers[nI].nBytes - nSkip;
+				iCount++;
+			}
+		}
+		ssize_t iWritten = iCount > 0 ? writev(i_iFile,cVectors,iCount) : 0;
+		if (iWritten < 0)
+		{
+			if (errno == EAGAIN || errno == EWOULDBLOCK)
+				iRet = wait_for_file(i_iFile,POLLOUT);
+			else if (errno != EINTR)
+				iRet = errno;
+		}
+		else
+		{
+			// advance past the bytes written, which may end part way through a buffer
+			size_t nWritten = (size_t)iWritten;
+			while (nBuffer < i_nBuffers && nWritten >= i_pBuffers[nBuffer].nBytes - nOffset)
+			{
+				nWritten -= i_pBuffers[nBuffer].nBytes - nOffset;
+				nBuffer++;
+				nOffset = 0;
+			}
+			nOffset += nWritten;
+		}
+	}
+#endif
+	return iRet;
+}
+
+int xstdtsl_fd_read(int i_iFile, void * o_pData, size_t i_nBytes, size_t * o_pnRead) noexcept
+{
+	int iRet = 0;
+	size_t nRead = 0;
+	bool bEnd = false;
+	char * pData = static_cast<char *>(o_pData);
+	while (iRet == 0 && !bEnd && nRead < i_nBytes)
+	{
+		size_t nRemaining = i_nBytes - nRead;
+#ifdef __XSTDTSL_WINDOWS
+		int iCount = _read(i_iFile,pData + nRead,(unsigned int)(nRemaining < g_nMax_Transfer ? nRemaining : g_nMax_Transfer));
+		if (iCount < 0)
+			iRet = errno;
+#else
+		ssize_t iCount = read(i_iFile,pData + nRead,nRemaining < (size_t)SSIZE_MAX ? nRemaining : (size_t)SSIZE_MAX);
+		if (iCount < 0)
+		{
+			if (errno == EAGAIN || errno == EWOULDBLOCK)
+				iRet = wait_for_file(i_iFile,POLLIN);
+			else if (errno != EINTR)
+				iRet = errno;
+		}
+#endif
+		else if (iCount == 0)
+			bEnd = true;
+		else
+			nRead += (size_t)iCount;
+	}
+	if (o_pnRead != nullptr)
+		*o_pnRead = nRead;
+	return iRet;
+}
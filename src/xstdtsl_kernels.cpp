@@ -0,0 +1,1027 @@
+#include <xstdtsl_kernels_internal.hpp>
+#include <limits>
+
+#ifdef __XSTDTSL_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define __XSTDTSL_TARGET(x) __attribute__((target(x)))
+#else
+#define __XSTDTSL_TARGET(x)
+#endif
+
+///
+/// index of the lowest set bit of a non-zero mask
+///
+static inline unsigned int first_bit(unsigned int i_uMask) noexcept
+{
+#ifdef _MSC_VER
+	unsigned long uIdx;
+	_BitScanForward(&uIdx,i_uMask);
+	return (unsigned int)uIdx;
+#else
+	return (unsigned int)__builtin_ctz(i_uMask);
+#endif
+}
+///
+/// number of set bits in a mask
+///
+static inline unsigned int bit_count(unsigned int i_uMask) noexcept
+{
+#ifdef _MSC_VER
+	return (unsigned int)__popcnt(i_uMask);
+#else
+	return (unsigned int)__builtin_popcount(i_uMask);
+#endif
+}
+///
+/// fold elements into a running minimum and maximum; comparisons with NaN are false, so NaN elements are ignored
+///
+template <class T> static inline void minmax_tail(const T * i_pData, size_t i_nCount, T & io_tMin, T & io_tMax) noexcept
+{
+	for (size_t nI = 0; nI < i_nCount; nI++)
+	{
+		if (i_pData[nI] < io_tMin)
+			io_tMin = i_pData[nI];
+		if (i_pData[nI] > io_tMax)
+			io_tMax = i_pData[nI];
+	}
+}
+///
+/// fold the lanes of a vector minimum and a vector maximum, stored to arrays, into a running minimum and maximum
+///
+template <class T> static inline void fold_lanes(const T * i_pMin_Lanes, const T * i_pMax_Lanes, size_t i_nLanes, T & io_tMin, T & io_tMax) noexcept
+{
+	for (size_t nLane = 0; nLane < i_nLanes; nLane++)
+	{
+		if (i_pMin_Lanes[nLane] < io_tMin)
+			io_tMin = i_pMin_Lanes[nLane];
+		if (i_pMax_Lanes[nLane] > io_tMax)
+			io_tMax = i_pMax_Lanes[nLane];
+	}
+}
+
+//----------------------------------------------------------------------------
+// scalar kernels
+//----------------------------------------------------------------------------
+
+static size_t find_32_scalar(const void * i_pData, size_t i_nCount, uint32_t i_uValue) noexcept
+{
+	const uint32_t * pData = reinterpret_cast<const uint32_t *>(i_pData);
+	for (size_t nI = 0; nI < i_nCount; nI++)
+	{
+		if (pData[nI] == i_uValue)
+			return nI;
+	}
+	return i_nCount;
+}
+static size_t find_64_scalar(const void * i_pData, size_t i_nCount, uint64_t i_uValue) noexcept
+{
+	const uint64_t * pData = reinterpret_cast<const uint64_t *>(i_pData);
+	for (size_t nI = 0; nI < i_nCount; nI++)
+	{
+		if (pData[nI] == i_uValue)
+			return nI;
+	}
+	return i_nCount;
+}
+
+static size_t find_f32_scalar(const void * i_pData, size_t i_nCount, float i_fValue) noexcept
+{
+	const float * pData = reinterpret_cast<const float *>(i_pData);
+	for (size_t nI = 0; nI < i_nCount; nI++)
+	{
+		if (pData[nI] == i_fValue)
+			return nI;
+	}
+	return i_nCount;
+}
+static size_t find_f64_scalar(const void * i_pData, size_t i_nCount, double i_dValue) noexcept
+{
+	const double * pData = reinterpret_cast<const double *>(i_pData);
+	for (size_t nI = 0; nI < i_nCount; nI++)
+	{
+		if (pData[nI] == i_dValue)
+			return nI;
+	}
+	return i_nCount;
+}
+static size_t count_32_scalar(const void * i_pData, size_t i_nCount, uint32_t i_uValue) noexcept
+{
+	const uint32_t * pData = reinterpret_cast<const uint32_t *>(i_pData);
+	size_t nRet = 0;
+	for (size_t nI = 0; nI < i_nCount; nI++)
+		nRet += pData[nI] == i_uValue ? 1 : 0;
+	return nRet;
+}
+static size_t count_64_scalar(const void * i_pData, size_t i_nCount, uint64_t i_uValue) noexcept
+{
+	const uint64_t * pData = reinterpret_cast<const uint64_t *>(i_pData);
+	size_t nRet = 0;
+	for (size_t nI = 0; nI < i_nCount; nI++)
+		nRet += pData[nI] == i_uValue ? 1 : 0;
+	return nRet;
+}
+static size_t count_f32_scalar(const void * i_pData, size_t i_nCount, float i_fValue) noexcept
+{
+	const float * pData = reinterpret_cast<const float *>(i_pData);
+	size_t nRet = 0;
+	for (size_t nI = 0; nI < i_nCount; nI++)
+		nRet += pData[nI] == i_fValue ? 1 : 0;
+	return nRet;
+}
+static size_t count_f64_scalar(const void * i_pData, size_t i_nCount, double i_dValue) noexcept
+{
+	const double * pData = reinterpret_cast<const double *>(i_pData);
+	size_t nRet = 0;
+	for (size_t nI = 0; nI < i_nCount; nI++)
+		nRet += pData[nI] == i_dValue ? 1 : 0;
+	return nRet;
+}
+static void minmax_i32_scalar(const void * i_pData, size_t i_nCount, int32_t * o_piMin, int32_t * o_piMax) noexcept
+{
+	const int32_t * pData = reinterpret_cast<const int32_t *>(i_pData);
+	int32_t iMin = pData[0];
+	int32_t iMax = pData[0];
+	minmax_tail(pData + 1,i_nCount - 1,iMin,iMax);
+	*o_piMin = iMin;
+	*o_piMax = iMax;
+}
+static void minmax_i64_scalar(const void * i_pData, size_t i_nCount, int64_t * o_piMin, int64_t * o_piMax) noexcept
+{
+	const int64_t * pData = reinterpret_cast<const int64_t *>(i_pData);
+	int64_t iMin = pData[0];
+	int64_t iMax = pData[0];
+	minmax_tail(pData + 1,i_nCount - 1,iMin,iMax);
+	*o_piMin = iMin;
+	*o_piMax = iMax;
+}
+static void minmax_f32_scalar(const void * i_pData, size_t i_nCount, float * o_pfMin, float * o_pfMax) noexcept
+{
+	float fMin = std::numeric_limits<float>::infinity();
+	float fMax = -std::numeric_limits<float>::infinity();
+	minmax_tail(reinterpret_cast<const float *>(i_pData),i_nCount,fMin,fMax);
+	*o_pfMin = fMin;
+	*o_pfMax = fMax;
+}
+static void minmax_f64_scalar(const void * i_pData, size_t i_nCount, double * o_pdMin, double * o_pdMax) noexcept
+{
+	double dMin = std::numeric_limits<double>::infinity();
+	double dMax = -std::numeric_limits<double>::infinity();
+	minmax_tail(reinterpret_cast<const double *>(i_pData),i_nCount,dMin,dMax);
+	*o_pdMin = dMin;
+	*o_pdMax = dMax;
+}
+static int64_t sum_i32_scalar(const void * i_pData, size_t i_nCount) noexcept
+{
+	const int32_t * pData = reinterpret_cast<const int32_t *>(i_pData);
+	int64_t iRet = 0;
+	for (size_t nI = 0; nI < i_nCount; nI++)
+		iRet += pData[nI];
+	return iRet;
+}
+static int64_t sum_i64_scalar(const void * i_pData, size_t i_nCount) noexcept
+{
+	// unsigned arithmetic so that overflow wraps rather than being undefined
+	const uint64_t * pData = reinterpret_cast<const uint64_t *>(i_pData);
+	uint64_t uRet = 0;
+	for (size_t nI = 0; nI < i_nCount; nI++)
+		uRet += pData[nI];
+	return (int64_t)uRet;
+}
+static double sum_f32_scalar(const void * i_pData, size_t i_nCount) noexcept
+{
+	const float * pData = reinterpret_cast<const float *>(i_pData);
+	double dRet = 0.0;
+	for (size_t nI = 0; nI < i_nCount; nI++)
+		dRet += pData[nI];
+	return dRet;
+}
+static double sum_f64_scalar(const void * i_pData, size_t i_nCount) noexcept
+{
+	const double * pData = reinterpret_cast<const double *>(i_pData);
+	double dRet = 0.0;
+	for (size_t nI = 0; nI < i_nCount; nI++)
+		dRet += pData[nI];
+	return dRet;
+}
+
+#ifdef __XSTDTSL_X86
+//----------------------------------------------------------------------------
+// SSE4.2 kernels
+//----------------------------------------------------------------------------
+
+__XSTDTSL_TARGET("sse4.2") static size_t find_32_sse42(const void * i_pData, size_t i_nCount, uint32_t i_uValue) noexcept
+{
+	const uint32_t * pData = reinterpret_cast<const uint32_t *>(i_pData);
+	const __m128i vValue = _mm_set1_epi32((int)i_uValue);
+	size_t nI = 0;
+	for (; nI + 4 <= i_nCount; nI += 4)
+	{
+		__m128i vData = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pData + nI));
+		unsigned int uMask = (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(vData,vValue)));
+		if (uMask != 0)
+			return nI + first_bit(uMask);
+	}
+	return nI + find_32_scalar(pData + nI,i_nCount - nI,i_uValue);
+}
+__XSTDTSL_TARGET("sse4.2") static size_t find_64_sse42(const void * i_pData, size_t i_nCount, uint64_t i_uValue) noexcept
+{
+	const uint64_t * pData = reinterpret_cast<const uint64_t *>(i_pData);
+	const __m128i vValue = _mm_set1_epi64x((long long)i_uValue);
+	size_t nI = 0;
+	for (; nI + 2 <= i_nCount; nI += 2)
+	{
+		__m128i vData = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pData + nI));
+		unsigned int uMask = (unsigned int)_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(vData,vValue)));
+		if (uMask != 0)
+			return nI + first_bit(uMask);
+	}
+	return nI + find_64_scalar(pData + nI,i_nCount - nI,i_uValue);
+}
+
+__XSTDTSL_TARGET("sse4.2") static size_t find_f32_sse42(const void * i_pData, size_t i_nCount, float i_fValue) noexcept
+{
+	const float * pData = reinterpret_cast<const float *>(i_pData);
+	const __m128 vValue = _mm_set1_ps(i_fValue);
+	size_t nI = 0;
+	for (; nI + 4 <= i_nCount; nI += 4)
+	{
+		unsigned int uMask = (unsigned int)_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(pData + nI),vValue));
+		if (uMask != 0)
+			return nI + first_bit(uMask);
+	}
+	return nI + find_f32_scalar(pData + nI,i_nCount - nI,i_fValue);
+}
+__XSTDTSL_TARGET("sse4.2") static size_t find_f64_sse42(const void * i_pData, size_t i_nCount, double i_dValue) noexcept
+{
+	const double * pData = reinterpret_cast<const double *>(i_pData);
+	const __m128d vValue = _mm_set1_pd(i_dValue);
+	size_t nI = 0;
+	for (; nI + 2 <= i_nCount; nI += 2)
+	{
+		unsigned int uMask = (unsigned int)_mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(pData + nI),vValue));
+		if (uMask != 0)
+			return nI + first_bit(uMask);
+	}
+	return nI + find_f64_scalar(pData + nI,i_nCount - nI,i_dValue);
+}
+__XSTDTSL_TARGET("sse4.2") static size_t count_32_sse42(const void * i_pData, size_t i_nCount, uint32_t i_uValue) noexcept
+{
+	const uint32_t * pData = reinterpret_cast<const uint32_t *>(i_pData);
+	const __m128i vValue = _mm_set1_epi32((int)i_uValue);
+	size_t nRet = 0;
+	size_t nI = 0;
+	for (; nI + 4 <= i_nCount; nI += 4)
+		nRet += bit_count((unsigned int)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pData + nI)),vValue))));
+	return nRet + count_32_scalar(pData + nI,i_nCount - nI,i_uValue);
+}
+__XSTDTSL_TARGET("sse4.2") static size_t count_64_sse42(const void * i_pData, size_t i_nCount, uint64_t i_uValue) noexcept
+{
+	const uint64_t * pData = reinterpret_cast<const uint64_t *>(i_pData);
+	const __m128i vValue = _mm_set1_epi64x((long long)i_uValue);
+	size_t nRet = 0;
+	size_t nI = 0;
+	for (; nI + 2 <= i_nCount; nI += 2)
+		nRet += bit_count((unsigned int)_mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pData + nI)),vValue))));
+	return nRet + count_64_scalar(pData + nI,i_nCount - nI,i_uValue);
+}
+__XSTDTSL_TARGET("sse4.2") static size_t count_f32_sse42(const void * i_pData, size_t i_nCount, float i_fValue) noexcept
+{
+	const float * pData = reinterpret_cast<const float *>(i_pData);
+	const __m128 vValue = _mm_set1_ps(i_fValue);
+	size_t nRet = 0;
+	size_t nI = 0;
+	for (; nI + 4 <= i_nCount; nI += 4)
+		nRet += bit_count((unsigned int)_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(pData + nI),vValue)));
+	return nRet + count_f32_scalar(pData + nI,i_nCount - nI,i_fValue);
+}
+__XSTDTSL_TARGET("sse4.2") static size_t count_f64_sse42(const void * i_pData, size_t i_nCount, double i_dValue) noexcept
+{
+	const double * pData = reinterpret_cast<const double *>(i_pData);
+	const __m128d vValue = _mm_set1_pd(i_dValue);
+	size_t nRet = 0;
+	size_t nI = 0;
+	for (; nI + 2 <= i_nCount; nI += 2)
+		nRet += bit_count((unsigned int)_mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(pData + nI),vValue)));
+	return nRet + count_f64_scalar(pData + nI,i_nCount - nI,i_dValue);
+}
+__XSTDTSL_TARGET("sse4.2") static void minmax_i32_sse42(const void * i_pData, size_t i_nCount, int32_t * o_piMin, int32_t * o_piMax) noexcept
+{
+	const int32_t * pData = reinterpret_cast<const int32_t *>(i_pData);
+	if (i_nCount < 4)
+		minmax_i32_scalar(pData,i_nCount,o_piMin,o_piMax);
+	else
+	{
+		__m128i vMin = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pData));
+		__m128i vMax = vMin;
+		size_t nI = 4;
+		for (; nI + 4 <= i_nCount; nI += 4)
+		{
+			__m128i vData = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pData + nI));
+			vMin = _mm_min_epi32(vMin,vData);
+			vMax = _mm_max_epi32(vMax,vData);
+		}
+		int32_t iLanes_Min[4];
+		int32_t iLanes_Max[4];
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(iLanes_Min),vMin);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(iLanes_Max),vMax);
+		int32_t iMin = iLanes_Min[0];
+		int32_t iMax = iLanes_Max[0];
+		minmax_tail(iLanes_Min + 1,3,iMin,iMax);
+		minmax_tail(iLanes_Max + 1,3,iMin,iMax);
+		minmax_tail(pData + nI,i_nCount - nI,iMin,iMax);
+		*o_piMin = iMin;
+		*o_piMax = iMax;
+	}
+}
+__XSTDTSL_TARGET("sse4.2") static void minmax_i64_sse42(const void * i_pData, size_t i_nCount, int64_t * o_piMin, int64_t * o_piMax) noexcept
+{
+	const int64_t * pData = reinterpret_cast<const int64_t *>(i_pData);
+	if (i_nCount < 2)
+		minmax_i64_scalar(pData,i_nCount,o_piMin,o_piMax);
+	else
+	{
+		__m128i vMin = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pData));
+		__m128i vMax = vMin;
+		size_t nI = 2;
+		for (; nI + 2 <= i_nCount; nI += 2)
+		{
+			__m128i vData = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pData + nI));
+			vMin = _mm_blendv_epi8(vMin,vData,_mm_cmpgt_epi64(vMin,vData));
+			vMax = _mm_blendv_epi8(vMax,vData,_mm_cmpgt_epi64(vData,vMax));
+		}
+		int64_t iLanes_Min[2];
+		int64_t iLanes_Max[2];
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(iLanes_Min),vMin);
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(iLanes_Max),vMax);
+		int64_t iMin = iLanes_Min[0];
+		int64_t iMax = iLanes_Max[0];
+		minmax_tail(iLanes_Min + 1,1,iMin,iMax);
+		minmax_tail(iLanes_Max + 1,1,iMin,iMax);
+		minmax_tail(pData + nI,i_nCount - nI,iMin,iMax);
+		*o_piMin = iMin;
+		*o_piMax = iMax;
+	}
+}
+__XSTDTSL_TARGET("sse4.2") static void minmax_f32_sse42(const void * i_pData, size_t i_nCount, float * o_pfMin, float * o_pfMax) noexcept
+{
+	const float * pData = reinterpret_cast<const float *>(i_pData);
+	// minps and maxps return the second operand when either is NaN, so NaN elements leave the running values unchanged
+	__m128 vMin = _mm_set1_ps(std::numeric_limits<float>::infinity());
+	__m128 vMax = _mm_set1_ps(-std::numeric_limits<float>::infinity());
+	size_t nI = 0;
+	for (; nI + 4 <= i_nCount; nI += 4)
+	{
+		__m128 vData = _mm_loadu_ps(pData + nI);
+		vMin = _mm_min_ps(vData,vMin);
+		vMax = _mm_max_ps(vData,vMax);
+	}
+	float fLanes_Min[4];
+	float fLanes_Max[4];
+	_mm_storeu_ps(fLanes_Min,vMin);
+	_mm_storeu_ps(fLanes_Max,vMax);
+	float fMin = std::numeric_limits<float>::infinity();
+	float fMax = -std::numeric_limits<float>::infinity();
+	fold_lanes(fLanes_Min,fLanes_Max,4,fMin,fMax);
+	minmax_tail(pData + nI,i_nCount - nI,fMin,fMax);
+	*o_pfMin = fMin;
+	*o_pfMax = fMax;
+}
+__XSTDTSL_TARGET("sse4.2") static void minmax_f64_sse42(const void * i_pData, size_t i_nCount, double * o_pdMin, double * o_pdMax) noexcept
+{
+	const double * pData = reinterpret_cast<const double *>(i_pData);
+	__m128d vMin = _mm_set1_pd(std::numeric_limits<double>::infinity());
+	__m128d vMax = _mm_set1_pd(-std::numeric_limits<double>::infinity());
+	size_t nI = 0;
+	for (; nI + 2 <= i_nCount; nI += 2)
+	{
+		__m128d vData = _mm_loadu_pd(pData + nI);
+		vMin = _mm_min_pd(vData,vMin);
+		vMax = _mm_max_pd(vData,vMax);
+	}
+	double dLanes_Min[2];
+	double dLanes_Max[2];
+	_mm_storeu_pd(dLanes_Min,vMin);
+	_mm_storeu_pd(dLanes_Max,vMax);
+	double dMin = std::numeric_limits<double>::infinity();
+	double dMax = -std::numeric_limits<double>::infinity();
+	fold_lanes(dLanes_Min,dLanes_Max,2,dMin,dMax);
+	minmax_tail(pData + nI,i_nCount - nI,dMin,dMax);
+	*o_pdMin = dMin;
+	*o_pdMax = dMax;
+}
+__XSTDTSL_TARGET("sse4.2") static int64_t sum_i32_sse42(const void * i_pData, size_t i_nCount) noexcept
+{
+	const int32_t * pData = reinterpret_cast<const int32_t *>(i_pData);
+	__m128i vSum = _mm_setzero_si128();
+	size_t nI = 0;
+	for (; nI + 4 <= i_nCount; nI += 4)
+	{
+		__m128i vData = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pData + nI));
+		vSum = _mm_add_epi64(vSum,_mm_cvtepi32_epi64(vData));
+		vSum = _mm_add_epi64(vSum,_mm_cvtepi32_epi64(_mm_srli_si128(vData,8)));
+	}
+	int64_t iLanes[2];
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(iLanes),vSum);
+	return iLanes[0] + iLanes[1] + sum_i32_scalar(pData + nI,i_nCount - nI);
+}
+__XSTDTSL_TARGET("sse4.2") static int64_t sum_i64_sse42(const void * i_pData, size_t i_nCount) noexcept
+{
+	const int64_t * pData = reinterpret_cast<const int64_t *>(i_pData);
+	__m128i vSum = _mm_setzero_si128();
+	size_t nI = 0;
+	for (; nI + 2 <= i_nCount; nI += 2)
+		vSum = _mm_add_epi64(vSum,_mm_loadu_si128(reinterpret_cast<const __m128i *>(pData + nI)));
+	uint64_t uLanes[2];
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(uLanes),vSum);
+	return (int64_t)(uLanes[0] + uLanes[1] + (uint64_t)sum_i64_scalar(pData + nI,i_nCount - nI));
+}
+__XSTDTSL_TARGET("sse4.2") static double sum_f32_sse42(const void * i_pData, size_t i_nCount) noexcept
+{
+	const float * pData = reinterpret_cast<const float *>(i_pData);
+	__m128d vSum = _mm_setzero_pd();
+	size_t nI = 0;
+	for (; nI + 4 <= i_nCount; nI += 4)
+	{
+		__m128 vData = _mm_loadu_ps(pData + nI);
+		vSum = _mm_add_pd(vSum,_mm_cvtps_pd(vData));
+		vSum = _mm_add_pd(vSum,_mm_cvtps_pd(_mm_movehl_ps(vData,vData)));
+	}
+	double dLanes[2];
+	_mm_storeu_pd(dLanes,vSum);
+	return dLanes[0] + dLanes[1] + sum_f32_scalar(pData + nI,i_nCount - nI);
+}
+__XSTDTSL_TARGET("sse4.2") static double sum_f64_sse42(const void * i_pData, size_t i_nCount) noexcept
+{
+	const double * pData = reinterpret_cast<const double *>(i_pData);
+	__m128d vSum = _mm_setzero_pd();
+	size_t nI = 0;
+	for (; nI + 2 <= i_nCount; nI += 2)
+		vSum = _mm_add_pd(vSum,_mm_loadu_pd(pData + nI));
+	double dLanes[2];
+	_mm_storeu_pd(dLanes,vSum);
+	return dLanes[0] + dLanes[1] + sum_f64_scalar(pData + nI,i_nCount - nI);
+}
+
+//----------------------------------------------------------------------------
+// AVX2 kernels
+//----------------------------------------------------------------------------
+
+__XSTDTSL_TARGET("avx2") static size_t find_32_avx2(const void * i_pData, size_t i_nCount, uint32_t i_uValue) noexcept
+{
+	const uint32_t * pData = reinterpret_cast<const uint32_t *>(i_pData);
+	const __m256i vValue = _mm256_set1_epi32((int)i_uValue);
+	size_t nI = 0;
+	for (; nI + 8 <= i_nCount; nI += 8)
+	{
+		__m256i vData = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pData + nI));
+		unsigned int uMask = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(vData,vValue)));
+		if (uMask != 0)
+			return nI + first_bit(uMask);
+	}
+	return nI + find_32_scalar(pData + nI,i_nCount - nI,i_uValue);
+}
+__XSTDTSL_TARGET("avx2") static size_t find_64_avx2(const void * i_pData, size_t i_nCount, uint64_t i_uValue) noexcept
+{
+	const uint64_t * pData = reinterpret_cast<const uint64_t *>(i_pData);
+	const __m256i vValue = _mm256_set1_epi64x((long long)i_uValue);
+	size_t nI = 0;
+	for (; nI + 4 <= i_nCount; nI += 4)
+	{
+		__m256i vData = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pData + nI));
+		unsigned int uMask = (unsigned int)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(vData,vValue)));
+		if (uMask != 0)
+			return nI + first_bit(uMask);
+	}
+	return nI + find_64_scalar(pData + nI,i_nCount - nI,i_uValue);
+}
+
+__XSTDTSL_TARGET("avx2") static size_t find_f32_avx2(const void * i_pData, size_t i_nCount, float i_fValue) noexcept
+{
+	const float * pData = reinterpret_cast<const float *>(i_pData);
+	const __m256 vValue = _mm256_set1_ps(i_fValue);
+	size_t nI = 0;
+	for (; nI + 8 <= i_nCount; nI += 8)
+	{
+		unsigned int uMask = (unsigned int)_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(pData + nI),vValue,_CMP_EQ_OQ));
+		if (uMask != 0)
+			return nI + first_bit(uMask);
+	}
+	return nI + find_f32_scalar(pData + nI,i_nCount - nI,i_fValue);
+}
+__XSTDTSL_TARGET("avx2") static size_t find_f64_avx2(const void * i_pData, size_t i_nCount, double i_dValue) noexcept
+{
+	const double * pData = reinterpret_cast<const double *>(i_pData);
+	const __m256d vValue = _mm256_set1_pd(i_dValue);
+	size_t nI = 0;
+	for (; nI + 4 <= i_nCount; nI += 4)
+	{
+		unsigned int uMask = (unsigned int)_mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(pData + nI),vValue,_CMP_EQ_OQ));
+		if (uMask != 0)
+			return nI + first_bit(uMask);
+	}
+	return nI + find_f64_scalar(pData + nI,i_nCount - nI,i_dValue);
+}
+__XSTDTSL_TARGET("avx2") static size_t count_32_avx2(const void * i_pData, size_t i_nCount, uint32_t i_uValue) noexcept
+{
+	const uint32_t * pData = reinterpret_cast<const uint32_t *>(i_pData);
+	const __m256i vValue = _mm256_set1_epi32((int)i_uValue);
+	size_t nRet = 0;
+	size_t nI = 0;
+	for (; nI + 8 <= i_nCount; nI += 8)
+		nRet += bit_count((unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(pData + nI)),vValue))));
+	return nRet + count_32_scalar(pData + nI,i_nCount - nI,i_uValue);
+}
+__XSTDTSL_TARGET("avx2") static size_t count_64_avx2(const void * i_pData, size_t i_nCount, uint64_t i_uValue) noexcept
+{
+	const uint64_t * pData = reinterpret_cast<const uint64_t *>(i_pData);
+	const __m256i vValue = _mm256_set1_epi64x((long long)i_uValue);
+	size_t nRet = 0;
+	size_t nI = 0;
+	for (; nI + 4 <= i_nCount; nI += 4)
+		nRet += bit_count((unsigned int)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(pData + nI)),vValue))));
+	return nRet + count_64_scalar(pData + nI,i_nCount - nI,i_uValue);
+}
+__XSTDTSL_TARGET("avx2") static size_t count_f32_avx2(const void * i_pData, size_t i_nCount, float i_fValue) noexcept
+{
+	const float * pData = reinterpret_cast<const float *>(i_pData);
+	const __m256 vValue = _mm256_set1_ps(i_fValue);
+	size_t nRet = 0;
+	size_t nI = 0;
+	for (; nI + 8 <= i_nCount; nI += 8)
+		nRet += bit_count((unsigned int)_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(pData + nI),vValue,_CMP_EQ_OQ)));
+	return nRet + count_f32_scalar(pData + nI,i_nCount - nI,i_fValue);
+}
+__XSTDTSL_TARGET("avx2") static size_t count_f64_avx2(const void * i_pData, size_t i_nCount, double i_dValue) noexcept
+{
+	const double * pData = reinterpret_cast<const double *>(i_pData);
+	const __m256d vValue = _mm256_set1_pd(i_dValue);
+	size_t nRet = 0;
+	size_t nI = 0;
+	for (; nI + 4 <= i_nCount; nI += 4)
+		nRet += bit_count((unsigned int)_mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(pData + nI),vValue,_CMP_EQ_OQ)));
+	return nRet + count_f64_scalar(pData + nI,i_nCount - nI,i_dValue);
+}
+__XSTDTSL_TARGET("avx2") static void minmax_i32_avx2(const void * i_pData, size_t i_nCount, int32_t * o_piMin, int32_t * o_piMax) noexcept
+{
+	const int32_t * pData = reinterpret_cast<const int32_t *>(i_pData);
+	if (i_nCount < 8)
+		minmax_i32_scalar(pData,i_nCount,o_piMin,o_piMax);
+	else
+	{
+		__m256i vMin = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pData));
+		__m256i vMax = vMin;
+		size_t nI = 8;
+		for (; nI + 8 <= i_nCount; nI += 8)
+		{
+			__m256i vData = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pData + nI));
+			vMin = _mm256_min_epi32(vMin,vData);
+			vMax = _mm256_max_epi32(vMax,vData);
+		}
+		int32_t iLanes_Min[8];
+		int32_t iLanes_Max[8];
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(iLanes_Min),vMin);
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(iLanes_Max),vMax);
+		int32_t iMin = iLanes_Min[0];
+		int32_t iMax = iLanes_Max[0];
+		minmax_tail(iLanes_Min + 1,7,iMin,iMax);
+		minmax_tail(iLanes_Max + 1,7,iMin,iMax);
+		minmax_tail(pData + nI,i_nCount - nI,iMin,iMax);
+		*o_piMin = iMin;
+		*o_piMax = iMax;
+	}
+}
+__XSTDTSL_TARGET("avx2") static void minmax_i64_avx2(const void * i_pData, size_t i_nCount, int64_t * o_piMin, int64_t * o_piMax) noexcept
+{
+	const int64_t * pData = reinterpret_cast<const int64_t *>(i_pData);
+	if (i_nCount < 4)
+		minmax_i64_scalar(pData,i_nCount,o_piMin,o_piMax);
+	else
+	{
+		__m256i vMin = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pData));
+		__m256i vMax = vMin;
+		size_t nI = 4;
+		for (; nI + 4 <= i_nCount; nI += 4)
+		{
+			__m256i vData = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pData + nI));
+			vMin = _mm256_blendv_epi8(vMin,vData,_mm256_cmpgt_epi64(vMin,vData));
+			vMax = _mm256_blendv_epi8(vMax,vData,_mm256_cmpgt_epi64(vData,vMax));
+		}
+		int64_t iLanes_Min[4];
+		int64_t iLanes_Max[4];
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(iLanes_Min),vMin);
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(iLanes_Max),vMax);
+		int64_t iMin = iLanes_Min[0];
+		int64_t iMax = iLanes_Max[0];
+		minmax_tail(iLanes_Min + 1,3,iMin,iMax);
+		minmax_tail(iLanes_Max + 1,3,iMin,iMax);
+		minmax_tail(pData + nI,i_nCount - nI,iMin,iMax);
+		*o_piMin = iMin;
+		*o_piMax = iMax;
+	}
+}
+__XSTDTSL_TARGET("avx2") static void minmax_f32_avx2(const void * i_pData, size_t i_nCount, float * o_pfMin, float * o_pfMax) noexcept
+{
+	const float * pData = reinterpret_cast<const float *>(i_pData);
+	__m256 vMin = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+	__m256 vMax = _mm256_set1_ps(-std::numeric_limits<float>::infinity());
+	size_t nI = 0;
+	for (; nI + 8 <= i_nCount; nI += 8)
+	{
+		__m256 vData = _mm256_loadu_ps(pData + nI);
+		vMin = _mm256_min_ps(vData,vMin);
+		vMax = _mm256_max_ps(vData,vMax);
+	}
+	float fLanes_Min[8];
+	float fLanes_Max[8];
+	_mm256_storeu_ps(fLanes_Min,vMin);
+	_mm256_storeu_ps(fLanes_Max,vMax);
+	float fMin = std::numeric_limits<float>::infinity();
+	float fMax = -std::numeric_limits<float>::infinity();
+	fold_lanes(fLanes_Min,fLanes_Max,8,fMin,fMax);
+	minmax_tail(pData + nI,i_nCount - nI,fMin,fMax);
+	*o_pfMin = fMin;
+	*o_pfMax = fMax;
+}
+__XSTDTSL_TARGET("avx2") static void minmax_f64_avx2(const void * i_pData, size_t i_nCount, double * o_pdMin, double * o_pdMax) noexcept
+{
+	const double * pData = reinterpret_cast<const double *>(i_pData);
+	__m256d vMin = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+	__m256d vMax = _mm256_set1_pd(-std::numeric_limits<double>::infinity());
+	size_t nI = 0;
+	for (; nI + 4 <= i_nCount; nI += 4)
+	{
+		__m256d vData = _mm256_loadu_pd(pData + nI);
+		vMin = _mm256_min_pd(vData,vMin);
+		vMax = _mm256_max_pd(vData,vMax);
+	}
+	double dLanes_Min[4];
+	double dLanes_Max[4];
+	_mm256_storeu_pd(dLanes_Min,vMin);
+	_mm256_storeu_pd(dLanes_Max,vMax);
+	double dMin = std::numeric_limits<double>::infinity();
+	double dMax = -std::numeric_limits<double>::infinity();
+	fold_lanes(dLanes_Min,dLanes_Max,4,dMin,dMax);
+	minmax_tail(pData + nI,i_nCount - nI,dMin,dMax);
+	*o_pdMin = dMin;
+	*o_pdMax = dMax;
+}
+__XSTDTSL_TARGET("avx2") static int64_t sum_i32_avx2(const void * i_pData, size_t i_nCount) noexcept
+{
+	const int32_t * pData = reinterpret_cast<const int32_t *>(i_pData);
+	__m256i vSum = _mm256_setzero_si256();
+	size_t nI = 0;
+	for (; nI + 8 <= i_nCount; nI += 8)
+	{
+		__m256i vData = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pData + nI));
+		vSum = _mm256_add_epi64(vSum,_mm256_cvtepi32_epi64(_mm256_castsi256_si128(vData)));
+		vSum = _mm256_add_epi64(vSum,_mm256_cvtepi32_epi64(_mm256_extracti128_si256(vData,1)));
+	}
+	int64_t iLanes[4];
+	_mm256_storeu_si256(reinterpret_cast<__m256i *>(iLanes),vSum);
+	return iLanes[0] + iLanes[1] + iLanes[2] + iLanes[3] + sum_i32_scalar(pData + nI,i_nCount - nI);
+}
+__XSTDTSL_TARGET("avx2") static int64_t sum_i64_avx2(const void * i_pData, size_t i_nCount) noexcept
+{
+	const int64_t * pData = reinterpret_cast<const int64_t *>(i_pData);
+	__m256i vSum = _mm256_setzero_si256();
+	size_t nI = 0;
+	for (; nI + 4 <= i_nCount; nI += 4)
+		vSum = _mm256_add_epi64(vSum,_mm256_loadu_si256(reinterpret_cast<const __m256i *>(pData + nI)));
+	uint64_t uLanes[4];
+	_mm256_storeu_si256(reinterpret_cast<__m256i *>(uLanes),vSum);
+	return (int64_t)(uLanes[0] + uLanes[1] + uLanes[2] + uLanes[3] + (uint64_t)sum_i64_scalar(pData + nI,i_nCount - nI));
+}
+__XSTDTSL_TARGET("avx2") static double sum_f32_avx2(const void * i_pData, size_t i_nCount) noexcept
+{
+	const float * pData = reinterpret_cast<const float *>(i_pData);
+	__m256d vSum = _mm256_setzero_pd();
+	size_t nI = 0;
+	for (; nI + 8 <= i_nCount; nI += 8)
+	{
+		__m256 vData = _mm256_loadu_ps(pData + nI);
+		vSum = _mm256_add_pd(vSum,_mm256_cvtps_pd(_mm256_castps256_ps128(vData)));
+		vSum = _mm256_add_pd(vSum,_mm256_cvtps_pd(_mm256_extractf128_ps(vData,1)));
+	}
+	double dLanes[4];
+	_mm256_storeu_pd(dLanes,vSum);
+	return dLanes[0] + dLanes[1] + dLanes[2] + dLanes[3] + sum_f32_scalar(pData + nI,i_nCount - nI);
+}
+__XSTDTSL_TARGET("avx2") static double sum_f64_avx2(const void * i_pData, size_t i_nCount) noexcept
+{
+	const double * pData = reinterpret_cast<const double *>(i_pData);
+	// two accumulators so that consecutive adds do not wait on each other
+	__m256d vSum_A = _mm256_setzero_pd();
+	__m256d vSum_B = _mm256_setzero_pd();
+	size_t nI = 0;
+	for (; nI + 8 <= i_nCount; nI += 8)
+	{
+		vSum_A = _mm256_add_pd(vSum_A,_mm256_loadu_pd(pData + nI));
+		vSum_B = _mm256_add_pd(vSum_B,_mm256_loadu_pd(pData + nI + 4));
+	}
+	double dLanes[4];
+	_mm256_storeu_pd(dLanes,_mm256_add_pd(vSum_A,vSum_B));
+	return dLanes[0] + dLanes[1] + dLanes[2] + dLanes[3] + sum_f64_scalar(pData + nI,i_nCount - nI);
+}
+
+//----------------------------------------------------------------------------
+// AVX-512 kernels
+//----------------------------------------------------------------------------
+
+// GCC implements the unmasked AVX-512 min, max, widening and extract intrinsics as their masked forms with an uninitialized source vector, which -Wall reports at every call site; these call the masked forms with every lane selected instead
+__XSTDTSL_TARGET("avx512f") static inline __m512i min_epi32_avx512(__m512i i_vA, __m512i i_vB) noexcept { return _mm512_mask_min_epi32(i_vA,(__mmask16)0xFFFF,i_vA,i_vB); }
+__XSTDTSL_TARGET("avx512f") static inline __m512i max_epi32_avx512(__m512i i_vA, __m512i i_vB) noexcept { return _mm512_mask_max_epi32(i_vA,(__mmask16)0xFFFF,i_vA,i_vB); }
+__XSTDTSL_TARGET("avx512f") static inline __m512i min_epi64_avx512(__m512i i_vA, __m512i i_vB) noexcept { return _mm512_mask_min_epi64(i_vA,(__mmask8)0xFF,i_vA,i_vB); }
+__XSTDTSL_TARGET("avx512f") static inline __m512i max_epi64_avx512(__m512i i_vA, __m512i i_vB) noexcept { return _mm512_mask_max_epi64(i_vA,(__mmask8)0xFF,i_vA,i_vB); }
+__XSTDTSL_TARGET("avx512f") static inline __m512 min_ps_avx512(__m512 i_vA, __m512 i_vB) noexcept { return _mm512_mask_min_ps(i_vA,(__mmask16)0xFFFF,i_vA,i_vB); }
+__XSTDTSL_TARGET("avx512f") static inline __m512 max_ps_avx512(__m512 i_vA, __m512 i_vB) noexcept { return _mm512_mask_max_ps(i_vA,(__mmask16)0xFFFF,i_vA,i_vB); }
+__XSTDTSL_TARGET("avx512f") static inline __m512d min_pd_avx512(__m512d i_vA, __m512d i_vB) noexcept { return _mm512_mask_min_pd(i_vA,(__mmask8)0xFF,i_vA,i_vB); }
+__XSTDTSL_TARGET("avx512f") static inline __m512d max_pd_avx512(__m512d i_vA, __m512d i_vB) noexcept { return _mm512_mask_max_pd(i_vA,(__mmask8)0xFF,i_vA,i_vB); }
+/// widen the low (0) or high (1) eight 32-bit integers to 64 bits
+__XSTDTSL_TARGET("avx512f") static inline __m512i widen_epi32_avx512(__m512i i_vData, int i_iHalf) noexcept
+{
+	__m256i vHalf = i_iHalf == 0 ? _mm512_mask_extracti64x4_epi64(_mm256_setzero_si256(),(__mmask8)0xF,i_vData,0) : _mm512_mask_extracti64x4_epi64(_mm256_setzero_si256(),(__mmask8)0xF,i_vData,1);
+	return _mm512_mask_cvtepi32_epi64(_mm512_setzero_si512(),(__mmask8)0xFF,vHalf);
+}
+/// widen the low (0) or high (1) eight floats to double
+__XSTDTSL_TARGET("avx512f") static inline __m512d widen_ps_avx512(__m512 i_vData, int i_iHalf) noexcept
+{
+	__m256d vHalf = i_iHalf == 0 ? _mm512_mask_extractf64x4_pd(_mm256_setzero_pd(),(__mmask8)0xF,_mm512_castps_pd(i_vData),0) : _mm512_mask_extractf64x4_pd(_mm256_setzero_pd(),(__mmask8)0xF,_mm512_castps_pd(i_vData),1);
+	return _mm512_mask_cvtps_pd(_mm512_setzero_pd(),(__mmask8)0xFF,_mm256_castpd_ps(vHalf));
+}
+
+__XSTDTSL_TARGET("avx512f") static size_t find_32_avx512(const void * i_pData, size_t i_nCount, uint32_t i_uValue) noexcept
+{
+	const uint32_t * pData = reinterpret_cast<const uint32_t *>(i_pData);
+	const __m512i vValue = _mm512_set1_epi32((int)i_uValue);
+	size_t nI = 0;
+	for (; nI + 16 <= i_nCount; nI += 16)
+	{
+		__m512i vData = _mm512_loadu_si512(reinterpret_cast<const void *>(pData + nI));
+		unsigned int uMask = (unsigned int)_mm512_cmpeq_epi32_mask(vData,vValue);
+		if (uMask != 0)
+			return nI + first_bit(uMask);
+	}
+	return nI + find_32_scalar(pData + nI,i_nCount - nI,i_uValue);
+}
+__XSTDTSL_TARGET("avx512f") static size_t find_64_avx512(const void * i_pData, size_t i_nCount, uint64_t i_uValue) noexcept
+{
+	const uint64_t * pData = reinterpret_cast<const uint64_t *>(i_pData);
+	const __m512i vValue = _mm512_set1_epi64((long long)i_uValue);
+	size_t nI = 0;
+	for (; nI + 8 <= i_nCount; nI += 8)
+	{
+		__m512i vData = _mm512_loadu_si512(reinterpret_cast<const void *>(pData + nI));
+		unsigned int uMask = (unsigned int)_mm512_cmpeq_epi64_mask(vData,vValue);
+		if (uMask != 0)
+			return nI + first_bit(uMask);
+	}
+	return nI + find_64_scalar(pData + nI,i_nCount - nI,i_uValue);
+}
+__XSTDTSL_TARGET("avx512f") static size_t find_f32_avx512(const void * i_pData, size_t i_nCount, float i_fValue) noexcept
+{
+	const float * pData = reinterpret_cast<const float *>(i_pData);
+	const __m512 vValue = _mm512_set1_ps(i_fValue);
+	size_t nI = 0;
+	for (; nI + 16 <= i_nCount; nI += 16)
+	{
+		unsigned int uMask = (unsigned int)_mm512_cmp_ps_mask(_mm512_loadu_ps(pData + nI),vValue,_CMP_EQ_OQ);
+		if (uMask != 0)
+			return nI + first_bit(uMask);
+	}
+	return nI + find_f32_scalar(pData + nI,i_nCount - nI,i_fValue);
+}
+__XSTDTSL_TARGET("avx512f") static size_t find_f64_avx512(const void * i_pData, size_t i_nCount, double i_dValue) noexcept
+{
+	const double * pData = reinterpret_cast<const double *>(i_pData);
+	const __m512d vValue = _mm512_set1_pd(i_dValue);
+	size_t nI = 0;
+	for (; nI + 8 <= i_nCount; nI += 8)
+	{
+		unsigned int uMask = (unsigned int)_mm512_cmp_pd_mask(_mm512_loadu_pd(pData + nI),vValue,_CMP_EQ_OQ);
+		if (uMask != 0)
+			return nI + first_bit(uMask);
+	}
+	return nI + find_f64_scalar(pData + nI,i_nCount - nI,i_dValue);
+}
+__XSTDTSL_TARGET("avx512f") static size_t count_32_avx512(const void * i_pData, size_t i_nCount, uint32_t i_uValue) noexcept
+{
+	const uint32_t * pData = reinterpret_cast<const uint32_t *>(i_pData);
+	const __m512i vValue = _mm512_set1_epi32((int)i_uValue);
+	size_t nRet = 0;
+	size_t nI = 0;
+	for (; nI + 16 <= i_nCount; nI += 16)
+		nRet += bit_count((unsigned int)_mm512_cmpeq_epi32_mask(_mm512_loadu_si512(reinterpret_cast<const void *>(pData + nI)),vValue));
+	return nRet + count_32_scalar(pData + nI,i_nCount - nI,i_uValue);
+}
+__XSTDTSL_TARGET("avx512f") static size_t count_64_avx512(const void * i_pData, size_t i_nCount, uint64_t i_uValue) noexcept
+{
+	const uint64_t * pData = reinterpret_cast<const uint64_t *>(i_pData);
+	const __m512i vValue = _mm512_set1_epi64((long long)i_uValue);
+	size_t nRet = 0;
+	size_t nI = 0;
+	for (; nI + 8 <= i_nCount; nI += 8)
+		nRet += bit_count((unsigned int)_mm512_cmpeq_epi64_mask(_mm512_loadu_si512(reinterpret_cast<const void *>(pData + nI)),vValue));
+	return nRet + count_64_scalar(pData + nI,i_nCount - nI,i_uValue);
+}
+__XSTDTSL_TARGET("avx512f") static size_t count_f32_avx512(const void * i_pData, size_t i_nCount, float i_fValue) noexcept
+{
+	const float * pData = reinterpret_cast<const float *>(i_pData);
+	const __m512 vValue = _mm512_set1_ps(i_fValue);
+	size_t nRet = 0;
+	size_t nI = 0;
+	for (; nI + 16 <= i_nCount; nI += 16)
+		nRet += bit_count((unsigned int)_mm512_cmp_ps_mask(_mm512_loadu_ps(pData + nI),vValue,_CMP_EQ_OQ));
+	return nRet + count_f32_scalar(pData + nI,i_nCount - nI,i_fValue);
+}
+__XSTDTSL_TARGET("avx512f") static size_t count_f64_avx512(const void * i_pData, size_t i_nCount, double i_dValue) noexcept
+{
+	const double * pData = reinterpret_cast<const double *>(i_pData);
+	const __m512d vValue = _mm512_set1_pd(i_dValue);
+	size_t nRet = 0;
+	size_t nI = 0;
+	for (; nI + 8 <= i_nCount; nI += 8)
+		nRet += bit_count((unsigned int)_mm512_cmp_pd_mask(_mm512_loadu_pd(pData + nI),vValue,_CMP_EQ_OQ));
+	return nRet + count_f64_scalar(pData + nI,i_nCount - nI,i_dValue);
+}
+__XSTDTSL_TARGET("avx512f") static void minmax_i32_avx512(const void * i_pData, size_t i_nCount, int32_t * o_piMin, int32_t * o_piMax) noexcept
+{
+	const int32_t * pData = reinterpret_cast<const int32_t *>(i_pData);
+	if (i_nCount < 16)
+		minmax_i32_scalar(pData,i_nCount,o_piMin,o_piMax);
+	else
+	{
+		__m512i vMin = _mm512_loadu_si512(reinterpret_cast<const void *>(pData));
+		__m512i vMax = vMin;
+		size_t nI = 16;
+		for (; nI + 16 <= i_nCount; nI += 16)
+		{
+			__m512i vData = _mm512_loadu_si512(reinterpret_cast<const void *>(pData + nI));
+			vMin = min_epi32_avx512(vMin,vData);
+			vMax = max_epi32_avx512(vMax,vData);
+		}
+		int32_t iLanes_Min[16];
+		int32_t iLanes_Max[16];
+		_mm512_storeu_si512(reinterpret_cast<void *>(iLanes_Min),vMin);
+		_mm512_storeu_si512(reinterpret_cast<void *>(iLanes_Max),vMax);
+		int32_t iMin = iLanes_Min[0];
+		int32_t iMax = iLanes_Max[0];
+		fold_lanes(iLanes_Min + 1,iLanes_Max + 1,15,iMin,iMax);
+		minmax_tail(pData + nI,i_nCount - nI,iMin,iMax);
+		*o_piMin = iMin;
+		*o_piMax = iMax;
+	}
+}
+__XSTDTSL_TARGET("avx512f") static void minmax_i64_avx512(const void * i_pData, size_t i_nCount, int64_t * o_piMin, int64_t * o_piMax) noexcept
+{
+	const int64_t * pData = reinterpret_cast<const int64_t *>(i_pData);
+	if (i_nCount < 8)
+		minmax_i64_scalar(pData,i_nCount,o_piMin,o_piMax);
+	else
+	{
+		__m512i vMin = _mm512_loadu_si512(reinterpret_cast<const void *>(pData));
+		__m512i vMax = vMin;
+		size_t nI = 8;
+		for (; nI + 8 <= i_nCount; nI += 8)
+		{
+			__m512i vData = _mm512_loadu_si512(reinterpret_cast<const void *>(pData + nI));
+			vMin = min_epi64_avx512(vMin,vData);
+			vMax = max_epi64_avx512(vMax,vData);
+		}
+		int64_t iLanes_Min[8];
+		int64_t iLanes_Max[8];
+		_mm512_storeu_si512(reinterpret_cast<void *>(iLanes_Min),vMin);
+		_mm512_storeu_si512(reinterpret_cast<void *>(iLanes_Max),vMax);
+		int64_t iMin = iLanes_Min[0];
+		int64_t iMax = iLanes_Max[0];
+		fold_lanes(iLanes_Min + 1,iLanes_Max + 1,7,iMin,iMax);
+		minmax_tail(pData + nI,i_nCount - nI,iMin,iMax);
+		*o_piMin = iMin;
+		*o_piMax = iMax;
+	}
+}
+__XSTDTSL_TARGET("avx512f") static void minmax_f32_avx512(const void * i_pData, size_t i_nCount, float * o_pfMin, float * o_pfMax) noexcept
+{
+	const float * pData = reinterpret_cast<const float *>(i_pData);
+	__m512 vMin = _mm512_set1_ps(std::numeric_limits<float>::infinity());
+	__m512 vMax = _mm512_set1_ps(-std::numeric_limits<float>::infinity());
+	size_t nI = 0;
+	for (; nI + 16 <= i_nCount; nI += 16)
+	{
+		__m512 vData = _mm512_loadu_ps(pData + nI);
+		vMin = min_ps_avx512(vData,vMin);
+		vMax = max_ps_avx512(vData,vMax);
+	}
+	float fLanes_Min[16];
+	float fLanes_Max[16];
+	_mm512_storeu_ps(fLanes_Min,vMin);
+	_mm512_storeu_ps(fLanes_Max,vMax);
+	float fMin = std::numeric_limits<float>::infinity();
+	float fMax = -std::numeric_limits<float>::infinity();
+	fold_lanes(fLanes_Min,fLanes_Max,16,fMin,fMax);
+	minmax_tail(pData + nI,i_nCount - nI,fMin,fMax);
+	*o_pfMin = fMin;
+	*o_pfMax = fMax;
+}
+__XSTDTSL_TARGET("avx512f") static void minmax_f64_avx512(const void * i_pData, size_t i_nCount, double * o_pdMin, double * o_pdMax) noexcept
+{
+	const double * pData = reinterpret_cast<const double *>(i_pData);
+	__m512d vMin = _mm512_set1_pd(std::numeric_limits<double>::infinity());
+	__m512d vMax = _mm512_set1_pd(-std::numeric_limits<double>::infinity());
+	size_t nI = 0;
+	for (; nI + 8 <= i_nCount; nI += 8)
+	{
+		__m512d vData = _mm512_loadu_pd(pData + nI);
+		vMin = min_pd_avx512(vData,vMin);
+		vMax = max_pd_avx512(vData,vMax);
+	}
+	double dLanes_Min[8];
+	double dLanes_Max[8];
+	_mm512_storeu_pd(dLanes_Min,vMin);
+	_mm512_storeu_pd(dLanes_Max,vMax);
+	double dMin = std::numeric_limits<double>::infinity();
+	double dMax = -std::numeric_limits<double>::infinity();
+	fold_lanes(dLanes_Min,dLanes_Max,8,dMin,dMax);
+	minmax_tail(pData + nI,i_nCount - nI,dMin,dMax);
+	*o_pdMin = dMin;
+	*o_pdMax = dMax;
+}
+__XSTDTSL_TARGET("avx512f") static int64_t sum_i32_avx512(const void * i_pData, size_t i_nCount) noexcept
+{
+	const int32_t * pData = reinterpret_cast<const int32_t *>(i_pData);
+	__m512i vSum = _mm512_setzero_si512();
+	size_t nI = 0;
+	for (; nI + 16 <= i_nCount; nI += 16)
+	{
+		__m512i vData = _mm512_loadu_si512(reinterpret_cast<const void *>(pData + nI));
+		vSum = _mm512_add_epi64(vSum,widen_epi32_avx512(vData,0));
+		vSum = _mm512_add_epi64(vSum,widen_epi32_avx512(vData,1));
+	}
+	int64_t iLanes[8];
+	_mm512_storeu_si512(reinterpret_cast<void *>(iLanes),vSum);
+	return sum_i64_scalar(iLanes,8) + sum_i32_scalar(pData + nI,i_nCount - nI);
+}
+__XSTDTSL_TARGET("avx512f") static int64_t sum_i64_avx512(const void * i_pData, size_t i_nCount) noexcept
+{
+	const int64_t * pData = reinterpret_cast<const int64_t *>(i_pData);
+	__m512i vSum = _mm512_setzero_si512();
+	size_t nI = 0;
+	for (; nI + 8 <= i_nCount; nI += 8)
+		vSum = _mm512_add_epi64(vSum,_mm512_loadu_si512(reinterpret_cast<const void *>(pData + nI)));
+	int64_t iLanes[8];
+	_mm512_storeu_si512(reinterpret_cast<void *>(iLanes),vSum);
+	return (int64_t)((uint64_t)sum_i64_scalar(iLanes,8) + (uint64_t)sum_i64_scalar(pData + nI,i_nCount - nI));
+}
+__XSTDTSL_TARGET("avx512f") static double sum_f32_avx512(const void * i_pData, size_t i_nCount) noexcept
+{
+	const float * pData = reinterpret_cast<const float *>(i_pData);
+	__m512d vSum = _mm512_setzero_pd();
+	size_t nI = 0;
+	for (; nI + 16 <= i_nCount; nI += 16)
+	{
+		__m512 vData = _mm512_loadu_ps(pData + nI);
+		vSum = _mm512_add_pd(vSum,widen_ps_avx512(vData,0));
+		vSum = _mm512_add_pd(vSum,widen_ps_avx512(vData,1));
+	}
+	double dLanes[8];
+	_mm512_storeu_pd(dLanes,vSum);
+	return sum_f64_scalar(dLanes,8) + sum_f32_scalar(pData + nI,i_nCount - nI);
+}
+__XSTDTSL_TARGET("avx512f") static double sum_f64_avx512(const void * i_pData, size_t i_nCount) noexcept
+{
+	const double * pData = reinterpret_cast<const double *>(i_pData);
+	__m512d vSum_A = _mm512_setzero_pd();
+	__m512d vSum_B = _mm512_setzero_pd();
+	size_t nI = 0;
+	for (; nI + 16 <= i_nCount; nI += 16)
+	{
+		vSum_A = _mm512_add_pd(vSum_A,_mm512_loadu_pd(pData + nI));
+		vSum_B = _mm512_add_pd(vSum_B,_mm512_loadu_pd(pData + nI + 8));
+	}
+	double dLanes[8];
+	_mm512_storeu_pd(dLanes,_mm512_add_pd(vSum_A,vSum_B));
+	return sum_f64_scalar(dLanes,8) + sum_f64_scalar(pData + nI,i_nCount - nI);
+}
+#endif // #ifdef __XSTDTSL_X86
+
+//----------------------------------------------------------------------------
+// kernel tables
+//----------------------------------------------------------------------------
+
+const xstdtsl_kernel_table xstdtsl_internal::g_cKernels_Scalar = {XSTDTSL_CPU_SCALAR,find_32_scalar,find_64_scalar,find_f32_scalar,find_f64_scalar,count_32_scalar,count_64_scalar,count_f32_scalar,count_f64_scalar,minmax_i32_scalar,minmax_i64_scalar,minmax_f32_scalar,minmax_f64_scalar,sum_i32_scalar,sum_i64_scalar,sum_f32_scalar,sum_f64_scalar};
+#ifdef __XSTDTSL_X86
+const xstdtsl_kernel_table xstdtsl_internal::g_cKernels_SSE42 = {XSTDTSL_CPU_SSE42,find_32_sse42,find_64_sse42,find_f32_sse42,find_f64_sse42,count_32_sse42,count_64_sse42,count_f32_sse42,count_f64_sse42,minmax_i32_sse42,minmax_i64_sse42,minmax_f32_sse42,minmax_f64_sse42,sum_i32_sse42,sum_i64_sse42,sum_f32_sse42,sum_f64_sse42};
+const xstdtsl_kernel_table xstdtsl_internal::g_cKernels_AVX2 = {XSTDTSL_CPU_AVX2,find_32_avx2,find_64_avx2,find_f32_avx2,find_f64_avx2,count_32_avx2,count_64_avx2,count_f32_avx2,count_f64_avx2,minmax_i32_avx2,minmax_i64_avx2,minmax_f32_avx2,minmax_f64_avx2,sum_i32_avx2,sum_i64_avx2,sum_f32_avx2,sum_f64_avx2};
+const xstdtsl_kernel_table xstdtsl_internal::g_cKernels_AVX512 = {XSTDTSL_CPU_AVX512,find_32_avx512,find_64_avx512,find_f32_avx512,find_f64_avx512,count_32_avx512,count_64_avx512,count_f32_avx512,count_f64_avx512,minmax_i32_avx512,minmax_i64_avx512,minmax_f32_avx512,minmax_f64_avx512,sum_i32_avx512,sum_i64_avx512,sum_f32_avx512,sum_f64_avx512};
+#else
+const xstdtsl_kernel_table xstdtsl_internal::g_cKernels_SSE42 = {XSTDTSL_CPU_SCALAR,find_32_scalar,find_64_scalar,find_f32_scalar,find_f64_scalar,count_32_scalar,count_64_scalar,count_f32_scalar,count_f64_scalar,minmax_i32_scalar,minmax_i64_scalar,minmax_f32_scalar,minmax_f64_scalar,sum_i32_scalar,sum_i64_scalar,sum_f32_scalar,sum_f64_scalar};
+const xstdtsl_kernel_table xstdtsl_internal::g_cKernels_AVX2 = {XSTDTSL_CPU_SCALAR,find_32_scalar,find_64_scalar,find_f32_scalar,find_f64_scalar,count_32_scalar,count_64_scalar,count_f32_scalar,count_f64_scalar,minmax_i32_scalar,minmax_i64_scalar,minmax_f32_scalar,minmax_f64_scalar,sum_i32_scalar,sum_i64_scalar,sum_f32_scalar,sum_f64_scalar};
+const xstdtsl_kernel_table xstdtsl_internal::g_cKernels_AVX512 = {XSTDTSL_CPU_SCALAR,find_32_scalar,find_64_scalar,find_f32_scalar,find_f64_scalar,count_32_scalar,count_64_scalar,count_f32_scalar,count_f64_scalar,minmax_i32_scalar,minmax_i64_scalar,minmax_f32_scalar,minmax_f64_scalar,sum_i32_scalar,sum_i64_scalar,sum_f32_scalar,sum_f64_scalar};
+#endif
+
+#undef __XSTDTSL_TARGET
@@ -201,6 +201,11 @@ namespace test_map
 		std::cout << "confirm map has value (" << i_nValue << ") at key (" << i_nKey << ")";
 		test::test(i_cTree.at(i_nKey) == i_nValue);
 	}
+	template <class map> void confirm_size(map & i_cTree, size_t i_nSize)
+	{
+		std::cout << "confirm map size is (" << i_nSize << ")";
+		test::test(i_cTree.size() == i_nSize);
+	}
 }
 
 namespace test_map_write_control
@@ -257,13 +262,23 @@ int main(int i_nNum_Params, char * i_pParams[])
 	}
 	{
 		map cMap;
+		test_map::confirm_size(cMap,0);
 		test_map::insert_element(cMap,1,1);
 		test_map::insert_element(cMap,2,2);
+		test_map::confirm_size(cMap,2);
 		test_map::store_element(cMap,1,3);
 		test_map::store_element(cMap,3,4);
+		test_map::confirm_size(cMap,3);
 		test_map::erase_element(cMap,3);
+		test_map::confirm_size(cMap,2);
+		test_map::erase_element(cMap,3);
+		test_map::confirm_size(cMap,2);
 		test_map::store_element(cMap,3,5);
-
+		test_map::confirm_size(cMap,3);
+		map cCopy(cMap);
+		test_map::confirm_size(cCopy,3);
+		test_map::clear_map(cMap);
+		test_map::confirm_size(cMap,0);
 	}
 
 	return 0;	
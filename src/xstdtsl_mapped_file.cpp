@@ -0,0 +1,249 @@
+#if defined _WIN32 || defined _WIN64
+#define __XSTDTSL_WINDOWS
+#include <windows.h>
+#else
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#endif
+#include <cstddef>
+#include <cstdint>
+#include <xstdtsl_system_C.h>
+
+#ifdef __XSTDTSL_WINDOWS
+///
+/// map the whole of an open file; the file must not be empty
+/// \returns 0 on success; the system error code otherwise
+///
+static int map_view(xstdtsl_mapped_file * io_pFile) noexcept
+{
+	int iRet = 0;
+	DWORD dwProtect = io_pFile->bRead_Only ? PAGE_READONLY : PAGE_READWRITE;
+	DWORD dwAccess = io_pFile->bRead_Only ? FILE_MAP_READ : FILE_MAP_WRITE;
+	HANDLE hMapping = CreateFileMappingA((HANDLE)io_pFile->iFile,nullptr,dwProtect,(DWORD)((uint64_t)io_pFile->nBytes >> 32),(DWORD)(io_pFile->nBytes & 0xffffffff),nullptr);
+	if (hMapping == nullptr)
+		iRet = (int)GetLastError();
+	else
+	{
+		io_pFile->pData = MapViewOfFile(hMapping,dwAccess,0,0,io_pFile->nBytes);
+		if (io_pFile->pData == nullptr)
+		{
+			iRet = (int)GetLastError();
+			CloseHandle(hMapping);
+		}
+		else
+			io_pFile->iMapping = (intptr_t)hMapping;
+	}
+	return iRet;
+}
+///
+/// release the view and mapping of a file, leaving the file open
+///
+static void unmap_view(xstdtsl_mapped_file * io_pFile) noexcept
+{
+	if (io_pFile->pData != nullptr)
+		UnmapViewOfFile(io_pFile->pData);
+	if (io_pFile->iMapping != 0)
+		CloseHandle((HANDLE)io_pFile->iMapping);
+	io_pFile->pData = nullptr;
+	io_pFile->iMapping = 0;
+}
+#endif
+
+int xstdtsl_mapped_file_open(const char * i_pPath, int i_iMode, xstdtsl_mapped_file * o_pFile) noexcept
+{
+	int iRet = 0;
+	o_pFile->pData = nullptr;
+	o_pFile->nBytes = 0;
+	o_pFile->iFile = -1;
+	o_pFile->iMapping = 0;
+	o_pFile->bRead_Only = i_iMode == XSTDTSL_MAP_READ_ONLY;
+#ifdef __XSTDTSL_WINDOWS
+	DWORD dwAccess = o_pFile->bRead_Only ? GENERIC_READ : GENERIC_READ | GENERIC_WRITE;
+	DWORD dwDisposition = i_iMode == XSTDTSL_MAP_CREATE ? CREATE_ALWAYS : (i_iMode == XSTDTSL_MAP_OPEN_OR_CREATE ? OPEN_ALWAYS : OPEN_EXISTING);
+	HANDLE hFile = CreateFileA(i_pPath,dwAccess,FILE_SHARE_READ | FILE_SHARE_WRITE,nullptr,dwDisposition,FILE_ATTRIBUTE_NORMAL,nullptr);
+	LARGE_INTEGER liSize;
+	if (hFile == INVALID_HANDLE_VALUE)
+		iRet = (int)GetLastError();
+	else if (!GetFileSizeEx(hFile,&liSize))
+	{
+		iRet = (int)GetLastError();
+		CloseHandle(hFile);
+	}
+	else
+	{
+		o_pFile->iFile = (intptr_t)hFile;
+		o_pFile->nBytes = (size_t)liSize.QuadPart;
+		if (o_pFile->nBytes > 0)
+			iRet = map_view(o_pFile);
+		if (iRet != 0)
+			xstdtsl_mapped_file_close(o_pFile);
+	}
+#else
+	int iFlags = o_pFile->bRead_Only ? O_RDONLY : O_RDWR;
+	if (i_iMode == XSTDTSL_MAP_CREATE)
+		iFlags |= O_CREAT | O_TRUNC;
+	else if (i_iMode == XSTDTSL_MAP_OPEN_OR_CREATE)
+		iFlags |= O_CREAT;
+	int iFile = open(i_pPath,iFlags | O_CLOEXEC,0644);
+	struct stat cStat;
+	if (iFile < 0)
+		iRet = errno;
+	else if (fstat(iFile,&cStat) != 0)
+	{
+		iRet = errno;
+		close(iFile);
+	}
+	else
+	{
+		o_pFile->iFile = iFile;
+		o_pFile->nBytes = (size_t)cStat.st_size;
+		if (o_pFile->nBytes > 0)
+		{
+			void * pData = mmap(nullptr,o_pFile->nBytes,o_pFile->bRead_Only ? PROT_READ : PROT_READ | PROT_WRITE,MAP_SHARED,iFile,0);
+			if (pData == MAP_FAILED)
+			{
+				iRet = errno;
+				xstdtsl_mapped_file_close(o_pFile);
+			}
+			else
+				o_pFile->pData = pData;
+		}
+	}
+#endif
+	return iRet;
+}
+
+int xstdtsl_mapped_file_resize(xstdtsl_mapped_file * io_pFile, size_t i_nBytes) noexcept
+{
+	int iRet = 0;
+	if (io_pFile->bRead_Only)
+	{
+#ifdef __XSTDTSL_WINDOWS
+		iRet = ERROR_ACCESS_DENIED;
+#else
+		iRet = EROFS;
+#endif
+	}
+	else if (i_nBytes != io_pFile->nBytes)
+	{
+#ifdef __XSTDTSL_WINDOWS
+		// a file can not be resized while a view of it is mapped
+		unmap_view(io_pFile);
+		LARGE_INTEGER liSize;
+		liSize.QuadPart = (LONGLONG)i_nBytes;
+		if (!SetFilePointerEx((HANDLE)io_pFile->iFile,liSize,nullptr,FILE_BEGIN) || !SetEndOfFile((HANDLE)io_pFile->iFile))
+			iRet = (int)GetLastError();
+		else
+			io_pFile->nBytes = i_nBytes;
+		if (io_pFile->nBytes > 0)
+		{
+			int iMap_Ret = map_view(io_pFile);
+			if (iRet == 0)
+				iRet = iMap_Ret;
+		}
+#else
+		int iFile = (int)io_pFile->iFile;
+		bool bGrow = i_nBytes > io_pFile->nBytes;
+		// grow the file before the mapping so that no page of the mapping lies beyond the end of the file; shrink it after
+		if (bGrow && ftruncate(iFile,(off_t)i_nBytes) != 0)
+			iRet = errno;
+		if (iRet == 0)
+		{
+			void * pData = nullptr;
+			if (i_nBytes == 0)
+				munmap(io_pFile->pData,io_pFile->nBytes);
+			else if (io_pFile->pData == nullptr)
+				pData = mmap(nullptr,i_nBytes,PROT_READ | PROT_WRITE,MAP_SHARED,iFile,0);
+			else
+			{
+#if defined __linux__
+				pData = mremap(io_pFile->pData,io_pFile->nBytes,i_nBytes,MREMAP_MAYMOVE);
+#else
+				pData = mmap(nullptr,i_nBytes,PROT_READ | PROT_WRITE,MAP_SHARED,iFile,0);
+				if (pData != MAP_FAILED)
+					munmap(io_pFile->pData,io_pFile->nBytes);
+#endif
+			}
+			if (pData == MAP_FAILED)
+			{
+				iRet = errno;
+				if (bGrow && ftruncate(iFile,(off_t)io_pFile->nBytes) != 0)
+					iRet = errno;
+			}
+			else
+			{
+				io_pFile->pData = pData;
+				io_pFile->nBytes = i_nBytes;
+				if (!bGrow && ftruncate(iFile,(off_t)i_nBytes) != 0)
+					iRet = errno;
+			}
+		}
+#endif
+	}
+	return iRet;
+}
+
+int xstdtsl_mapped_file_sync(const xstdtsl_mapped_file * i_pFile, size_t i_nOffset, size_t i_nBytes, bool i_bWait) noexcept
+{
+	int iRet = 0;
+	if (i_pFile->pData != nullptr && !i_pFile->bRead_Only && i_nOffset < i_pFile->nBytes)
+	{
+		if (i_nBytes > i_pFile->nBytes - i_nOffset)
+			i_nBytes = i_pFile->nBytes - i_nOffset;
+		// the flushed range must start on a page boundary
+		size_t nPage = xstdtsl_get_page_size();
+		size_t nStart = i_nOffset & ~(nPage - 1);
+		char * pStart = static_cast<char *>(i_pFile->pData) + nStart;
+		i_nBytes += i_nOffset - nStart;
+#ifdef __XSTDTSL_WINDOWS
+		if (!FlushViewOfFile(pStart,i_nBytes) || (i_bWait && !FlushFileBuffers((HANDLE)i_pFile->iFile)))
+			iRet = (int)GetLastError();
+#else
+		if (msync(pStart,i_nBytes,i_bWait ? MS_SYNC : MS_ASYNC) != 0)
+			iRet = errno;
+#endif
+	}
+	return iRet;
+}
+
+void xstdtsl_mapped_file_prefetch(const xstdtsl_mapped_file * i_pFile, size_t i_nOffset, size_t i_nBytes) noexcept
+{
+	if (i_pFile->pData != nullptr && i_nOffset < i_pFile->nBytes)
+	{
+		if (i_nBytes > i_pFile->nBytes - i_nOffset)
+			i_nBytes = i_pFile->nBytes - i_nOffset;
+		size_t nPage = xstdtsl_get_page_size();
+		size_t nStart = i_nOffset & ~(nPage - 1);
+		char * pStart = static_cast<char *>(i_pFile->pData) + nStart;
+		i_nBytes += i_nOffset - nStart;
+#ifdef __XSTDTSL_WINDOWS
+		WIN32_MEMORY_RANGE_ENTRY cRange;
+		cRange.VirtualAddress = pStart;
+		cRange.NumberOfBytes = i_nBytes;
+		PrefetchVirtualMemory(GetCurrentProcess(),1,&cRange,0);
+#else
+		madvise(pStart,i_nBytes,MADV_WILLNEED);
+#endif
+	}
+}
+
+void xstdtsl_mapped_file_close(xstdtsl_mapped_file * io_pFile) noexcept
+{
+#ifdef __XSTDTSL_WINDOWS
+	unmap_view(io_pFile);
+	if (io_pFile->iFile != -1)
+		CloseHandle((HANDLE)io_pFile->iFile);
+#else
+	if (io_pFile->pData != nullptr)
+		munmap(io_pFile->pData,io_pFile->nBytes);
+	if (io_pFile->iFile != -1)
+		close((int)io_pFile->iFile);
+#endif
+	io_pFile->pData = nullptr;
+	io_pFile->nBytes = 0;
+	io_pFile->iFile = -1;
+}
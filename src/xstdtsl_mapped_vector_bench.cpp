@@ -0,0 +1,62 @@
+#include <xstdtsl_safe_mapped_vector>
+#include <xstdtsl_safe_vector>
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <filesystem>
+
+///
+/// get the time elapsed since a starting point
+/// \returns the elapsed time in milliseconds
+///
+static double elapsed_ms(std::chrono::steady_clock::time_point i_tStart)
+{
+	return std::chrono::duration<double,std::milli>(std::chrono::steady_clock::now() - i_tStart).count();
+}
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	size_t nCount = 64 * 1024 * 1024;
+	if (i_nNum_Params > 1)
+		nCount = std::strtoul(i_pParams[1],nullptr,10);
+	std::string sPath = (std::filesystem::temp_directory_path() / "xstdtsl_mapped_vector_bench.bin").string();
+	volatile uint64_t uSink = 0;
+
+	std::cout << "--------------=============== mapped vector startup benchmark ===============--------------" << std::endl;
+	std::cout << "elements: " << nCount << " (" << nCount * sizeof(uint64_t) / (1024 * 1024) << " MiB)" << std::endl;
+	std::cout << "operation\tms" << std::endl;
+	{
+		auto tStart = std::chrono::steady_clock::now();
+		xstdtsl::safe_vector<uint64_t> cVector;
+		for (size_t nI = 0; nI < nCount; nI++)
+			cVector.push_back(nI);
+		std::cout << "safe_vector load by push_back\t" << elapsed_ms(tStart) << std::endl;
+	}
+	{
+		auto tStart = std::chrono::steady_clock::now();
+		xstdtsl::safe_mapped_vector<uint64_t> cMapped(sPath.c_str(),XSTDTSL_MAP_CREATE);
+		for (size_t nI = 0; nI < nCount; nI++)
+			cMapped.push_back(nI);
+		std::cout << "safe_mapped_vector build by push_back\t" << elapsed_ms(tStart) << std::endl;
+		tStart = std::chrono::steady_clock::now();
+		cMapped.sync();
+		std::cout << "safe_mapped_vector sync\t" << elapsed_ms(tStart) << std::endl;
+	}
+	{
+		auto tStart = std::chrono::steady_clock::now();
+		xstdtsl::safe_mapped_vector<uint64_t> cMapped(sPath.c_str(),XSTDTSL_MAP_READ_ONLY);
+		uSink = uSink + cMapped.size();
+		std::cout << "safe_mapped_vector reopen\t" << elapsed_ms(tStart) << std::endl;
+		tStart = std::chrono::steady_clock::now();
+		uSink = uSink + cMapped.load(nCount / 2);
+		std::cout << "first random load after reopen\t" << elapsed_ms(tStart) << std::endl;
+		tStart = std::chrono::steady_clock::now();
+		uSink = uSink + cMapped.find(nCount - 1);
+		std::cout << "full scan (find) after reopen\t" << elapsed_ms(tStart) << std::endl;
+	}
+	std::remove(sPath.c_str());
+	return 0;
+}
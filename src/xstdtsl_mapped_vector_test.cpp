@@ -0,0 +1,167 @@
+#include <xstdtsl_safe_mapped_vector>
+#include <thread>
+#include <atomic>
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include <filesystem>
+#include <chrono>
+#include <cstdio>
+
+///
+/// a record with a layout that must be preserved by the file
+///
+struct record
+{
+	int64_t	m_iKey;
+	double	m_dValue;
+	bool operator ==(const record & i_cRHO) const
+	{
+		return m_iKey == i_cRHO.m_iKey && m_dValue == i_cRHO.m_dValue;
+	}
+};
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	std::string sPath = (std::filesystem::temp_directory_path() / ("xstdtsl_mapped_vector_test_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + ".bin")).string();
+	std::cout << "--------------=============== safe_mapped_vector tests ===============--------------" << std::endl;
+	{
+		std::cout << "create a new file" << std::endl;
+		xstdtsl::safe_mapped_vector<int32_t> cSMV(sPath.c_str(),XSTDTSL_MAP_CREATE);
+		assert(cSMV.empty());
+		assert(cSMV.capacity() > 0);
+		assert(!cSMV.read_only());
+		std::cout << "push_back beyond the initial capacity" << std::endl;
+		for (int32_t iI = 0; iI < 100000; iI++)
+			cSMV.push_back(iI);
+		assert(cSMV.size() == 100000);
+		assert(cSMV.capacity() >= 100000);
+		std::cout << "confirm contents" << std::endl;
+		for (int32_t iI = 0; iI < 100000; iI += 7)
+			assert(cSMV.load(iI) == iI);
+		assert(cSMV.load(100000) == 0);
+		assert(cSMV.find(77777) == 77777);
+		assert(cSMV.find(5,6) == 100000);
+		std::cout << "store, ranges and append" << std::endl;
+		cSMV.store(0,-1);
+		int32_t lpiBlock[4] = {-2,-3,-4,-5};
+		assert(cSMV.store_range(99998,lpiBlock,4) == 2);
+		cSMV.append(lpiBlock,4);
+		assert(cSMV.size() == 100004);
+		int32_t lpiOut[8];
+		assert(cSMV.load_range(99998,8,lpiOut) == 6);
+		assert(lpiOut[0] == -2 && lpiOut[1] == -3 && lpiOut[2] == -2 && lpiOut[5] == -5);
+		std::cout << "sync to the device" << std::endl;
+		cSMV.sync();
+		cSMV.sync(false);
+	}
+	{
+		std::cout << "reopen the file and confirm contents are kept" << std::endl;
+		xstdtsl::safe_mapped_vector<int32_t> cSMV(sPath.c_str());
+		assert(cSMV.size() == 100004);
+		assert(cSMV.load(0) == -1);
+		assert(cSMV.load(5000) == 5000);
+		assert(cSMV.load(100003) == -5);
+		cSMV.prefetch();
+		std::cout << "resize, shrink_to_fit and clear" << std::endl;
+		cSMV.resize(10,7);
+		assert(cSMV.size() == 10);
+		cSMV.resize(20,7);
+		assert(cSMV.load(9) == 9 && cSMV.load(10) == 7 && cSMV.load(19) == 7);
+		cSMV.shrink_to_fit();
+		assert(cSMV.capacity() == 20);
+		assert(std::filesystem::file_size(sPath) == 64 + 20 * sizeof(int32_t));
+		cSMV.push_back(8);
+		assert(cSMV.load(20) == 8);
+		cSMV.reserve(5000);
+		assert(cSMV.capacity() == 5000);
+	}
+	{
+		std::cout << "open read only" << std::endl;
+		xstdtsl::safe_mapped_vector<int32_t> cSMV(sPath.c_str(),XSTDTSL_MAP_READ_ONLY);
+		assert(cSMV.read_only());
+		assert(cSMV.size() == 21);
+		assert(cSMV.load(20) == 8);
+		std::cout << "confirm modifications of a read only vector are refused" << std::endl;
+		bool bThrew = false;
+		try
+		{
+			cSMV.push_back(1);
+		}
+		catch (const std::system_error &)
+		{
+			bThrew = true;
+		}
+		assert(bThrew);
+		assert(cSMV.size() == 21);
+	}
+	{
+		std::cout << "confirm a file of another type or data version is rejected" << std::endl;
+		bool bThrew = false;
+		try
+		{
+			xstdtsl::safe_mapped_vector<int64_t> cSMV(sPath.c_str());
+		}
+		catch (const std::runtime_error &)
+		{
+			bThrew = true;
+		}
+		assert(bThrew);
+		bThrew = false;
+		try
+		{
+			xstdtsl::safe_mapped_vector<int32_t> cSMV(sPath.c_str(),XSTDTSL_MAP_OPEN_EXISTING,2);
+		}
+		catch (const std::runtime_error &)
+		{
+			bThrew = true;
+		}
+		assert(bThrew);
+		std::cout << "confirm a missing file is reported" << std::endl;
+		bThrew = false;
+		try
+		{
+			xstdtsl::safe_mapped_vector<int32_t> cSMV((sPath + ".missing").c_str(),XSTDTSL_MAP_OPEN_EXISTING);
+		}
+		catch (const std::system_error &)
+		{
+			bThrew = true;
+		}
+		assert(bThrew);
+	}
+	{
+		std::cout << "records with a data version" << std::endl;
+		{
+			xstdtsl::safe_mapped_vector<record> cSMV(sPath.c_str(),XSTDTSL_MAP_CREATE,3);
+			for (int64_t iI = 0; iI < 1000; iI++)
+				cSMV.emplace_back(record{iI,iI * 0.5});
+		}
+		xstdtsl::safe_mapped_vector<record> cSMV(sPath.c_str(),XSTDTSL_MAP_OPEN_EXISTING,3);
+		assert(cSMV.size() == 1000);
+		assert(cSMV.load(999).m_dValue == 499.5);
+		assert(cSMV.find(record{500,250.0}) == 500);
+	}
+	{
+		std::cout << "read concurrently with appends that move the mapping" << std::endl;
+		xstdtsl::safe_mapped_vector<int64_t> cSMV(sPath.c_str(),XSTDTSL_MAP_CREATE);
+		std::atomic<bool> bDone(false);
+		std::thread cReader([&cSMV,&bDone]()
+		{
+			while (!bDone.load())
+			{
+				size_t nSize = cSMV.size();
+				for (size_t nI = 0; nI < nSize; nI += 997)
+					assert(cSMV.load(nI) == (int64_t)nI);
+				std::this_thread::yield();
+			}
+		});
+		for (int64_t iI = 0; iI < 200000; iI++)
+			cSMV.push_back(iI);
+		bDone = true;
+		cReader.join();
+		assert(cSMV.size() == 200000);
+	}
+	std::remove(sPath.c_str());
+	return 0;
+}
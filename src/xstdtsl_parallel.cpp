@@ -0,0 +1,189 @@
+#include <xstdtsl_system_C.h>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
+#include <thread>
+
+///
+/// a batch of tasks submitted by xstdtsl_parallel_run
+///
+struct parallel_job
+{
+	void (*				m_fnTask)(void * i_pContext, size_t i_nTask) noexcept; ///< the task function
+	void *				m_pContext; ///< the context passed to the task function
+	size_t				m_nTasks; ///< the number of tasks
+	std::atomic<size_t>	m_nNext; ///< the next task to be claimed
+	std::atomic<size_t>	m_nDone; ///< the number of completed tasks
+	size_t				m_nActive; ///< the number of workers running tasks of the job; protected by the pool mutex
+};
+
+///
+/// process wide pool of worker threads; workers are started on demand and joined at exit
+///
+class parallel_pool
+{
+private:
+	std::mutex					m_mPool; ///< protects the job queue, the worker list and the stop flag
+	std::condition_variable		m_cvWork; ///< signalled when a job is queued or the thread count changes
+	std::condition_variable		m_cvDone; ///< signalled when the last task of a job completes
+	std::deque<parallel_job *>	m_dJobs; ///< jobs with unclaimed tasks
+	std::vector<std::thread>	m_vWorkers; ///< the worker threads
+	std::atomic<size_t>			m_nThreads; ///< the number of threads, including the caller, that run the tasks of a job; 0 uses the number of hardware threads
+	bool						m_bStop; ///< set at exit to stop the workers
+
+	///
+	/// claim and run tasks of a job until none remain
+	///
+	void run_tasks(parallel_job * io_pJob) noexcept
+	{
+		size_t nTask;
+		while ((nTask = io_pJob->m_nNext.fetch_add(1,std::memory_order_relaxed)) < io_pJob->m_nTasks)
+		{
+			io_pJob->m_fnTask(io_pJob->m_pContext,nTask);
+			io_pJob->m_nDone.fetch_add(1,std::memory_order_release);
+		}
+	}
+	///
+	/// remove a job from the queue if it is still present; caller must hold m_mPool
+	///
+	void nl_retire(parallel_job * i_pJob) noexcept
+	{
+		for (auto iJob = m_dJobs.begin(); iJob != m_dJobs.end(); iJob++)
+		{
+			if (*iJob == i_pJob)
+			{
+				m_dJobs.erase(iJob);
+				break;
+			}
+		}
+	}
+	///
+	/// worker thread body; workers whose index is at or beyond the configured thread count stay idle
+	///
+	void worker(size_t i_nIndex) noexcept
+	{
+		std::unique_lock<std::mutex> cLock(m_mPool);
+		while (!m_bStop)
+		{
+			if (!m_dJobs.empty() && i_nIndex + 1 < threads())
+			{
+				parallel_job * pJob = m_dJobs.front();
+				if (pJob->m_nNext.load(std::memory_order_relaxed) >= pJob->m_nTasks)
+					nl_retire(pJob);
+				else
+				{
+					// the job lives on the submitting thread's stack; it waits until no worker is using it
+					pJob->m_nActive++;
+					cLock.unlock();
+					run_tasks(pJob);
+					cLock.lock();
+					if (--pJob->m_nActive == 0)
+						m_cvDone.notify_all();
+				}
+			}
+			else
+				m_cvWork.wait(cLock);
+		}
+	}
+public:
+	parallel_pool(void) noexcept : m_nThreads(0), m_bStop(false)
+	{
+	}
+	~parallel_pool(void) noexcept
+	{
+		{
+			std::lock_guard<std::mutex> cLock(m_mPool);
+			m_bStop = true;
+			m_cvWork.notify_all();
+		}
+		for (auto & cThread : m_vWorkers)
+			cThread.join();
+	}
+	///
+	/// get the number of threads that run the tasks of a job
+	/// \returns the number of threads, including the calling thread
+	///
+	size_t threads(void) const noexcept
+	{
+		size_t nRet = m_nThreads.load(std::memory_order_relaxed);
+		if (nRet == 0)
+			nRet = std::thread::hardware_concurrency();
+		if (nRet == 0)
+			nRet = 1;
+		return nRet;
+	}
+	///
+	/// set the number of threads that run the tasks of a job
+	///
+	void set_threads(size_t i_nThreads) noexcept
+	{
+		std::lock_guard<std::mutex> cLock(m_mPool);
+		m_nThreads.store(i_nThreads,std::memory_order_relaxed);
+		m_cvWork.notify_all();
+	}
+	///
+	/// run a job on the calling thread and the workers; returns when every task has completed
+	///
+	void run(size_t i_nTasks, void (*i_fnTask)(void * i_pContext, size_t i_nTask) noexcept, void * i_pContext) noexcept
+	{
+		parallel_job cJob;
+		cJob.m_fnTask = i_fnTask;
+		cJob.m_pContext = i_pContext;
+		cJob.m_nTasks = i_nTasks;
+		cJob.m_nNext.store(0,std::memory_order_relaxed);
+		cJob.m_nDone.store(0,std::memory_order_relaxed);
+		cJob.m_nActive = 0;
+		size_t nThreads = threads();
+		if (i_nTasks > 1 && nThreads > 1)
+		{
+			std::lock_guard<std::mutex> cLock(m_mPool);
+			try
+			{
+				while (m_vWorkers.size() + 1 < nThreads)
+					m_vWorkers.emplace_back(&parallel_pool::worker,this,m_vWorkers.size());
+			}
+			catch (...)
+			{
+				// unable to start more workers; run with those that exist
+			}
+			m_dJobs.push_back(&cJob);
+			m_cvWork.notify_all();
+		}
+		run_tasks(&cJob);
+		if (i_nTasks > 1 && nThreads > 1)
+		{
+			std::unique_lock<std::mutex> cLock(m_mPool);
+			nl_retire(&cJob);
+			while (cJob.m_nDone.load(std::memory_order_acquire) < i_nTasks || cJob.m_nActive > 0)
+				m_cvDone.wait(cLock);
+		}
+	}
+};
+
+///
+/// get the process wide worker pool
+/// \returns the worker pool
+///
+static parallel_pool & get_parallel_pool(void) noexcept
+{
+	static parallel_pool g_cPool;
+	return g_cPool;
+}
+
+void xstdtsl_set_parallel_threads(size_t i_nThreads) noexcept
+{
+	get_parallel_pool().set_threads(i_nThreads);
+}
+
+size_t xstdtsl_get_parallel_threads(void) noexcept
+{
+	return get_parallel_pool().threads();
+}
+
+void xstdtsl_parallel_run(size_t i_nTasks, void (*i_fnTask)(void * i_pContext, size_t i_nTask) noexcept, void * i_pContext) noexcept
+{
+	if (i_nTasks > 0 && i_fnTask != nullptr)
+		get_parallel_pool().run(i_nTasks,i_fnTask,i_pContext);
+}
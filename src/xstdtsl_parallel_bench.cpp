@@ -0,0 +1,75 @@
+#include <xstdtsl_safe_vector>
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+#include <cstdlib>
+#include <cstdint>
+
+///
+/// time a single run of a function
+/// \returns the elapsed time in seconds
+///
+template <class F> double time_it(F i_fnWork)
+{
+	auto tStart = std::chrono::steady_clock::now();
+	i_fnWork();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+}
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	size_t nMax_Threads = 16;
+	size_t nElements = 10000000;
+	if (i_nNum_Params > 1)
+		nMax_Threads = std::strtoul(i_pParams[1],nullptr,10);
+	if (i_nNum_Params > 2)
+		nElements = std::strtoul(i_pParams[2],nullptr,10);
+
+	std::vector<uint64_t> vSource(nElements);
+	uint64_t uState = 88172645463325252ULL;
+	for (auto & uValue : vSource)
+	{
+		uState ^= uState << 13;
+		uState ^= uState >> 7;
+		uState ^= uState << 17;
+		uValue = uState >> 16;
+	}
+	auto fnWork = [](uint64_t i_uValue) { return (uint64_t)std::sqrt((double)i_uValue) + (i_uValue >> 3); };
+
+	std::cout << "--------------=============== parallel algorithm benchmark ===============--------------" << std::endl;
+	std::cout << "elements: " << nElements << std::endl;
+	std::vector<uint64_t> vSerial(vSource);
+	std::vector<uint64_t> vOut(nElements);
+	uint64_t uCheck = 0;
+	double dFor_Each = time_it([&]() { std::for_each(vSerial.begin(),vSerial.end(),[&fnWork](uint64_t & io_uValue) { io_uValue = fnWork(io_uValue); }); });
+	vSerial = vSource;
+	double dTransform = time_it([&]() { std::transform(vSerial.begin(),vSerial.end(),vOut.begin(),fnWork); });
+	double dReduce = time_it([&]() { uCheck += std::accumulate(vSerial.begin(),vSerial.end(),(uint64_t)0); });
+	double dScan = time_it([&]() { std::partial_sum(vSerial.begin(),vSerial.end(),vOut.begin()); });
+	double dSort = time_it([&]() { std::sort(vSerial.begin(),vSerial.end()); });
+	std::cout << "threads\tfor_each ms\ttransform ms\treduce ms\tinclusive scan ms\tsort ms" << std::endl;
+	std::cout << "std\t" << dFor_Each * 1.0e3 << "\t" << dTransform * 1.0e3 << "\t" << dReduce * 1.0e3 << "\t" << dScan * 1.0e3 << "\t" << dSort * 1.0e3 << std::endl;
+
+	for (size_t nThreads = 1; nThreads <= nMax_Threads; nThreads *= 2)
+	{
+		xstdtsl_set_parallel_threads(nThreads);
+		xstdtsl::safe_vector<uint64_t> cVector;
+		cVector.append(vSource.data(),vSource.size());
+		xstdtsl::safe_vector<uint64_t> cOut;
+		dFor_Each = time_it([&]() { cVector.parallel_for_each([&fnWork](uint64_t & io_uValue) { io_uValue = fnWork(io_uValue); }); });
+		cVector.store_range(0,vSource.data(),vSource.size());
+		dTransform = time_it([&]() { cVector.parallel_transform(cOut,fnWork); });
+		dReduce = time_it([&]() { uCheck += cVector.parallel_reduce(); });
+		dScan = time_it([&]() { cOut.parallel_inclusive_scan(); });
+		dSort = time_it([&]() { cVector.parallel_sort(); });
+		if (cVector.load(0) != vSerial[0] || cVector.load(nElements - 1) != vSerial[nElements - 1])
+			std::cout << "sort mismatch" << std::endl;
+		std::cout << nThreads << "\t" << dFor_Each * 1.0e3 << "\t" << dTransform * 1.0e3 << "\t" << dReduce * 1.0e3 << "\t" << dScan * 1.0e3 << "\t" << dSort * 1.0e3 << std::endl;
+	}
+	if (uCheck == 1)
+		std::cout << std::endl;
+	return 0;
+}
@@ -0,0 +1,147 @@
+#include <xstdtsl_safe_ring_buffer>
+#include <xstdtsl_safe_vector>
+#include <thread>
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <cstdint>
+#include <vector>
+
+///
+/// the approach the ring replaces: a safe_vector used as a circular buffer with external indices, each enqueue and dequeue taking the write lock
+///
+class locked_queue
+{
+private:
+	xstdtsl::safe_vector<int64_t>	m_cSlots; ///< the ring
+	size_t							m_nHead; ///< the position of the next element to dequeue; guarded by the write lock of m_cSlots
+	size_t							m_nTail; ///< the position of the next element to enqueue; guarded by the write lock of m_cSlots
+public:
+	explicit locked_queue(size_t i_nCapacity) : m_nHead(0), m_nTail(0)
+	{
+		m_cSlots.resize(i_nCapacity);
+	}
+	void push(int64_t i_iValue)
+	{
+		bool bDone = false;
+		while (!bDone)
+		{
+			{
+				xstdtsl::safe_vector<int64_t>::write_control cWrite(m_cSlots);
+				if (m_nTail - m_nHead < cWrite.size())
+				{
+					cWrite.store(m_nTail % cWrite.size(),i_iValue);
+					m_nTail++;
+					bDone = true;
+				}
+			}
+			if (!bDone)
+				std::this_thread::yield();
+		}
+	}
+	int64_t pop(void)
+	{
+		int64_t iRet = 0;
+		bool bDone = false;
+		while (!bDone)
+		{
+			{
+				xstdtsl::safe_vector<int64_t>::write_control cWrite(m_cSlots);
+				if (m_nTail != m_nHead)
+				{
+					iRet = cWrite.load(m_nHead % cWrite.size());
+					m_nHead++;
+					bDone = true;
+				}
+			}
+			if (!bDone)
+				std::this_thread::yield();
+		}
+		return iRet;
+	}
+};
+
+///
+/// move a number of elements from producer threads to consumer threads
+/// \returns the throughput in millions of elements per second
+///
+template <class P, class C> double run(size_t i_nProducers, size_t i_nConsumers, size_t i_nElements, P i_fnProduce, C i_fnConsume)
+{
+	std::vector<std::thread> vThreads;
+	auto tStart = std::chrono::steady_clock::now();
+	for (size_t nI = 0; nI < i_nConsumers; nI++)
+		vThreads.emplace_back([&,nI]() { i_fnConsume(i_nElements / i_nConsumers + (nI < i_nElements % i_nConsumers ? 1 : 0)); });
+	for (size_t nI = 0; nI < i_nProducers; nI++)
+		vThreads.emplace_back([&,nI]() { i_fnProduce(i_nElements / i_nProducers + (nI < i_nElements % i_nProducers ? 1 : 0)); });
+	for (std::thread & cThread : vThreads)
+		cThread.join();
+	return (double)i_nElements / std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count() * 1.0e-6;
+}
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	size_t nElements = 1 << 20;
+	size_t nCapacity = 1024;
+	size_t nBatch = 32;
+	if (i_nNum_Params > 1)
+		nElements = std::strtoul(i_pParams[1],nullptr,10);
+	if (i_nNum_Params > 2)
+		nCapacity = std::strtoul(i_pParams[2],nullptr,10);
+	if (i_nNum_Params > 3)
+		nBatch = std::strtoul(i_pParams[3],nullptr,10);
+
+	std::cout << "--------------=============== safe_ring_buffer throughput benchmark ===============--------------" << std::endl;
+	std::cout << "elements: " << nElements << " capacity: " << nCapacity << " batch: " << nBatch << " hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+	std::cout << "producers\tconsumers\tlocked safe_vector M/s\tring M/s\tring batch M/s" << std::endl;
+	std::vector<std::pair<size_t,size_t>> vShapes;
+	for (size_t nThreads = 1; nThreads <= 32; nThreads *= 2)
+	{
+		vShapes.push_back(std::make_pair(nThreads,nThreads));
+		if (nThreads > 1)
+		{
+			vShapes.push_back(std::make_pair((size_t)1,nThreads));
+			vShapes.push_back(std::make_pair(nThreads,(size_t)1));
+		}
+	}
+	for (const std::pair<size_t,size_t> & cShape : vShapes)
+	{
+		locked_queue cLocked(nCapacity);
+		double dLocked = run(cShape.first,cShape.second,nElements,
+			[&cLocked](size_t i_nCount) { for (size_t nI = 0; nI < i_nCount; nI++) cLocked.push((int64_t)nI); },
+			[&cLocked](size_t i_nCount) { int64_t iSum = 0; for (size_t nI = 0; nI < i_nCount; nI++) iSum += cLocked.pop(); volatile int64_t iSink = iSum; (void)iSink; });
+		xstdtsl::safe_ring_buffer<int64_t> cRing(nCapacity);
+		double dRing = run(cShape.first,cShape.second,nElements,
+			[&cRing](size_t i_nCount) { for (size_t nI = 0; nI < i_nCount; nI++) cRing.push((int64_t)nI); },
+			[&cRing](size_t i_nCount) { int64_t iSum = 0; for (size_t nI = 0; nI < i_nCount; nI++) iSum += cRing.pop(); volatile int64_t iSink = iSum; (void)iSink; });
+		double dBatch = run(cShape.first,cShape.second,nElements,
+			[&cRing,nBatch](size_t i_nCount)
+			{
+				std::vector<int64_t> vBatch(nBatch);
+				for (size_t nI = 0; nI < i_nCount; nI += nBatch)
+				{
+					size_t nCount = i_nCount - nI < nBatch ? i_nCount - nI : nBatch;
+					for (size_t nJ = 0; nJ < nCount; nJ++)
+						vBatch[nJ] = (int64_t)(nI + nJ);
+					cRing.push_batch(vBatch.data(),nCount);
+				}
+			},
+			[&cRing,nBatch](size_t i_nCount)
+			{
+				// take at most the remaining share so that every consumer ends with exactly its count
+				std::vector<int64_t> vBatch(nBatch);
+				int64_t iSum = 0;
+				size_t nDone = 0;
+				while (nDone < i_nCount)
+				{
+					size_t nCount = cRing.pop_batch(vBatch.data(),i_nCount - nDone < nBatch ? i_nCount - nDone : nBatch);
+					for (size_t nJ = 0; nJ < nCount; nJ++)
+						iSum += vBatch[nJ];
+					nDone += nCount;
+				}
+				volatile int64_t iSink = iSum;
+				(void)iSink;
+			});
+		std::cout << cShape.first << "\t" << cShape.second << "\t" << dLocked << "\t" << dRing << "\t" << dBatch << std::endl;
+	}
+	return 0;
+}
@@ -0,0 +1,189 @@
+#include <xstdtsl_safe_ring_buffer>
+#include <thread>
+#include <atomic>
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <iterator>
+
+///
+/// element type that counts live instances, to confirm that the ring destroys what it holds
+///
+class tracked
+{
+public:
+	static std::atomic<int> g_iLive; ///< number of instances currently constructed
+	int m_iValue; ///< the value held
+
+	tracked(void) noexcept : m_iValue(0) { g_iLive++; }
+	explicit tracked(int i_iValue) noexcept : m_iValue(i_iValue) { g_iLive++; }
+	tracked(const tracked & i_cRHO) noexcept : m_iValue(i_cRHO.m_iValue) { g_iLive++; }
+	tracked(tracked && i_cRHO) noexcept : m_iValue(i_cRHO.m_iValue) { g_iLive++; }
+	tracked & operator =(const tracked & i_cRHO) noexcept { m_iValue = i_cRHO.m_iValue; return *this; }
+	tracked & operator =(tracked && i_cRHO) noexcept { m_iValue = i_cRHO.m_iValue; return *this; }
+	~tracked(void) noexcept { g_iLive--; }
+};
+std::atomic<int> tracked::g_iLive(0);
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	std::cout << "--------------=============== safe_ring_buffer tests ===============--------------" << std::endl;
+	{
+		std::cout << "confirm the capacity is rounded to a power of two" << std::endl;
+		xstdtsl::safe_ring_buffer<int> cRing5(5);
+		assert(cRing5.capacity() == 8);
+		xstdtsl::safe_ring_buffer<int> cRing1(1);
+		assert(cRing1.capacity() == 2);
+		std::cout << "fill, confirm full, and drain in order" << std::endl;
+		xstdtsl::safe_ring_buffer<int> cRing(4);
+		assert(cRing.empty());
+		for (int iI = 0; iI < 4; iI++)
+			assert(cRing.try_push(iI));
+		assert(!cRing.try_push(4));
+		assert(cRing.size() == 4);
+		int iValue = -1;
+		for (int iI = 0; iI < 4; iI++)
+		{
+			assert(cRing.try_pop(iValue));
+			assert(iValue == iI);
+		}
+		assert(!cRing.try_pop(iValue));
+		assert(iValue == 3 && cRing.empty());
+		std::cout << "wrap around the ring many times" << std::endl;
+		for (int iI = 0; iI < 1000; iI++)
+		{
+			assert(cRing.try_emplace(iI));
+			assert(cRing.try_push(iI + 1));
+			assert(cRing.pop() == iI);
+			assert(cRing.pop() == iI + 1);
+		}
+		assert(cRing.empty());
+	}
+	{
+		std::cout << "batch enqueue and dequeue, limited by room and by content" << std::endl;
+		xstdtsl::safe_ring_buffer<int64_t> cRing(8);
+		int64_t iSource[12] = {0,1,2,3,4,5,6,7,8,9,10,11};
+		assert(cRing.try_push_batch(iSource,5) == 5);
+		assert(cRing.try_push_batch(iSource + 5,7) == 3);
+		assert(cRing.try_push_batch(iSource + 8,4) == 0);
+		int64_t iDest[12] = {};
+		assert(cRing.try_pop_batch(iDest,3) == 3);
+		assert(iDest[0] == 0 && iDest[2] == 2);
+		assert(cRing.try_push_batch(iSource + 8,4) == 3);
+		assert(cRing.try_pop_batch(iDest,12) == 8);
+		for (int iI = 0; iI < 8; iI++)
+			assert(iDest[iI] == iI + 3);
+		assert(cRing.try_pop_batch(iDest,12) == 0);
+	}
+	{
+		std::cout << "move strings in and out" << std::endl;
+		xstdtsl::safe_ring_buffer<std::string> cRing(16);
+		std::string sValue(100,'x');
+		assert(cRing.try_push(std::move(sValue)));
+		assert(sValue.empty());
+		std::string sCopy(50,'y');
+		cRing.push(sCopy);
+		assert(sCopy.size() == 50);
+		cRing.emplace((size_t)3,'z');
+		std::vector<std::string> vBatch = {"a","b","c"};
+		cRing.push_batch(std::make_move_iterator(vBatch.begin()),vBatch.size());
+		assert(cRing.pop() == std::string(100,'x'));
+		std::string sOut[5];
+		assert(cRing.pop_batch(sOut,5) == 5);
+		assert(sOut[0] == std::string(50,'y') && sOut[1] == "zzz" && sOut[2] == "a" && sOut[4] == "c");
+	}
+	{
+		std::cout << "confirm elements left in the ring are destroyed" << std::endl;
+		{
+			xstdtsl::safe_ring_buffer<tracked> cRing(8);
+			for (int iI = 0; iI < 6; iI++)
+				cRing.emplace(iI);
+			tracked cOut;
+			assert(cRing.try_pop(cOut) && cOut.m_iValue == 0);
+			assert(tracked::g_iLive == 6);
+		}
+		assert(tracked::g_iLive == 0);
+	}
+	{
+		std::cout << "4 producers and 4 consumers through a small ring, blocking" << std::endl;
+		xstdtsl::safe_ring_buffer<int64_t> cRing(16);
+		const int64_t iPer_Producer = 50000;
+		std::atomic<int64_t> iSum(0);
+		std::atomic<int64_t> iCount(0);
+		std::vector<std::thread> vThreads;
+		for (int64_t iP = 0; iP < 4; iP++)
+		{
+			vThreads.emplace_back([&cRing,iP,iPer_Producer]()
+			{
+				for (int64_t iI = 0; iI < iPer_Producer; iI++)
+					cRing.push(iP * iPer_Producer + iI);
+			});
+		}
+		for (int iC = 0; iC < 4; iC++)
+		{
+			vThreads.emplace_back([&cRing,&iSum,&iCount,iPer_Producer]()
+			{
+				int64_t iLocal_Sum = 0;
+				for (int64_t iI = 0; iI < iPer_Producer; iI++)
+					iLocal_Sum += cRing.pop();
+				iSum += iLocal_Sum;
+				iCount += iPer_Producer;
+			});
+		}
+		for (std::thread & cThread : vThreads)
+			cThread.join();
+		int64_t iTotal = 4 * iPer_Producer;
+		assert(iCount == iTotal);
+		assert(iSum == iTotal * (iTotal - 1) / 2);
+		assert(cRing.empty());
+	}
+	{
+		std::cout << "batched producers and consumers preserve each producer's order" << std::endl;
+		xstdtsl::safe_ring_buffer<int64_t> cRing(64);
+		const int64_t iPer_Producer = 40000;
+		const int iProducers = 3;
+		std::atomic<int64_t> iRemaining(iProducers * iPer_Producer);
+		std::atomic<bool> bOrdered(true);
+		std::vector<std::thread> vThreads;
+		for (int64_t iP = 0; iP < iProducers; iP++)
+		{
+			vThreads.emplace_back([&cRing,iP,iPer_Producer]()
+			{
+				std::vector<int64_t> vBatch(37);
+				for (int64_t iI = 0; iI < iPer_Producer; iI += (int64_t)vBatch.size())
+				{
+					size_t nCount = 0;
+					for (; nCount < vBatch.size() && iI + (int64_t)nCount < iPer_Producer; nCount++)
+						vBatch[nCount] = (iP << 32) | (iI + (int64_t)nCount);
+					cRing.push_batch(vBatch.data(),nCount);
+				}
+			});
+		}
+		// a single consumer sees every element, so each producer's values must arrive in increasing order
+		vThreads.emplace_back([&cRing,&iRemaining,&bOrdered,iProducers]()
+		{
+			std::vector<int64_t> vLast(iProducers,-1);
+			int64_t iBatch[29];
+			while (iRemaining > 0)
+			{
+				size_t nCount = cRing.pop_batch(iBatch,29);
+				for (size_t nI = 0; nI < nCount; nI++)
+				{
+					int64_t iP = iBatch[nI] >> 32;
+					int64_t iValue = iBatch[nI] & 0xffffffff;
+					if (iValue != vLast[iP] + 1)
+						bOrdered = false;
+					vLast[iP] = iValue;
+				}
+				iRemaining -= (int64_t)nCount;
+			}
+		});
+		for (std::thread & cThread : vThreads)
+			cThread.join();
+		assert(bOrdered);
+		assert(iRemaining == 0 && cRing.empty());
+	}
+	return 0;
+}
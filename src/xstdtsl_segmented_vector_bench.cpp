@@ -0,0 +1,101 @@
+#include <xstdtsl_safe_vector>
+#include <xstdtsl_safe_segmented_vector>
+#include <thread>
+#include <atomic>
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+///
+/// append elements one at a time, recording the longest single append and the total time
+///
+template <class V> void measure_growth(V & io_cVector, size_t i_nElements, double & o_dMax_Pause_us, double & o_dTotal_s)
+{
+	o_dMax_Pause_us = 0.0;
+	auto tStart = std::chrono::steady_clock::now();
+	for (size_t nI = 0; nI < i_nElements; nI++)
+	{
+		auto tPush = std::chrono::steady_clock::now();
+		io_cVector.push_back((int64_t)nI);
+		double dPause = std::chrono::duration<double,std::micro>(std::chrono::steady_clock::now() - tPush).count();
+		if (dPause > o_dMax_Pause_us)
+			o_dMax_Pause_us = dPause;
+	}
+	o_dTotal_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+}
+
+///
+/// time individual loads from a reader thread while a writer thread grows the vector
+/// \returns the sorted load latencies in microseconds
+///
+template <class V> std::vector<double> measure_read_latency(V & io_cVector, size_t i_nElements)
+{
+	std::vector<double> vLatency;
+	vLatency.reserve(1 << 20);
+	io_cVector.push_back(0);
+	std::atomic<bool> bDone(false);
+	std::thread cWriter([&io_cVector,&bDone,i_nElements]()
+	{
+		for (size_t nI = 1; nI < i_nElements; nI++)
+			io_cVector.push_back((int64_t)nI);
+		bDone = true;
+	});
+	uint64_t uState = 88172645463325252ULL;
+	int64_t iSum = 0;
+	while (!bDone.load() && vLatency.size() < vLatency.capacity())
+	{
+		uState ^= uState << 13;
+		uState ^= uState >> 7;
+		uState ^= uState << 17;
+		size_t nSize = io_cVector.size();
+		auto tLoad = std::chrono::steady_clock::now();
+		iSum += io_cVector.load(uState % nSize);
+		vLatency.push_back(std::chrono::duration<double,std::micro>(std::chrono::steady_clock::now() - tLoad).count());
+	}
+	cWriter.join();
+	if (iSum == -1)
+		std::cout << iSum;
+	std::sort(vLatency.begin(),vLatency.end());
+	if (vLatency.empty())
+		vLatency.push_back(0.0);
+	return vLatency;
+}
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	size_t nElements = 50000000;
+	if (i_nNum_Params > 1)
+		nElements = std::strtoul(i_pParams[1],nullptr,10);
+
+	std::cout << "--------------=============== segmented vector growth benchmark ===============--------------" << std::endl;
+	std::cout << "elements: " << nElements << std::endl;
+	double dMax_Pause, dTotal;
+	{
+		xstdtsl::safe_vector<int64_t> cVector;
+		measure_growth(cVector,nElements,dMax_Pause,dTotal);
+		std::cout << "safe_vector\tmax append pause (us): " << dMax_Pause << "\ttotal (s): " << dTotal << std::endl;
+	}
+	{
+		xstdtsl::safe_segmented_vector<int64_t> cVector;
+		measure_growth(cVector,nElements,dMax_Pause,dTotal);
+		std::cout << "safe_segmented_vector\tmax append pause (us): " << dMax_Pause << "\ttotal (s): " << dTotal << std::endl;
+	}
+	std::cout << "--------------=============== read latency during growth ===============--------------" << std::endl;
+	std::cout << "container\tp50 (us)\tp99 (us)\tp99.9 (us)\tmax (us)" << std::endl;
+	{
+		xstdtsl::safe_vector<int64_t> cVector;
+		std::vector<double> vLatency = measure_read_latency(cVector,nElements);
+		size_t nN = vLatency.size();
+		std::cout << "safe_vector\t" << vLatency[nN / 2] << "\t" << vLatency[nN * 99 / 100] << "\t" << vLatency[nN * 999 / 1000] << "\t" << vLatency[nN - 1] << std::endl;
+	}
+	{
+		xstdtsl::safe_segmented_vector<int64_t> cVector;
+		std::vector<double> vLatency = measure_read_latency(cVector,nElements);
+		size_t nN = vLatency.size();
+		std::cout << "safe_segmented_vector\t" << vLatency[nN / 2] << "\t" << vLatency[nN * 99 / 100] << "\t" << vLatency[nN * 999 / 1000] << "\t" << vLatency[nN - 1] << std::endl;
+	}
+	return 0;
+}
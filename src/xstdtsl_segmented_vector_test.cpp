@@ -0,0 +1,180 @@
+#include <xstdtsl_safe_segmented_vector>
+#include <thread>
+#include <atomic>
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+///
+/// element type that tracks live instances and whose copy constructor throws once the copy budget is spent
+///
+class counted_copy
+{
+public:
+	static int g_iLive; ///< number of instances alive
+	static int g_iCopies_Left; ///< copies allowed before the copy constructor throws; negative for no limit
+	int m_iValue; ///< the value held
+
+	explicit counted_copy(int i_iValue = 0) noexcept : m_iValue(i_iValue) { g_iLive++; }
+	counted_copy(const counted_copy & i_cRHO) noexcept(false) : m_iValue(i_cRHO.m_iValue)
+	{
+		if (g_iCopies_Left == 0)
+			throw std::runtime_error("copy");
+		if (g_iCopies_Left > 0)
+			g_iCopies_Left--;
+		g_iLive++;
+	}
+	counted_copy & operator =(const counted_copy & i_cRHO) noexcept { m_iValue = i_cRHO.m_iValue; return *this; }
+	bool operator ==(const counted_copy & i_cRHO) const noexcept { return m_iValue == i_cRHO.m_iValue; }
+	~counted_copy(void) noexcept { g_iLive--; }
+};
+int counted_copy::g_iLive = 0;
+int counted_copy::g_iCopies_Left = -1;
+
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	std::cout << "--------------=============== safe_segmented_vector tests ===============--------------" << std::endl;
+	{
+		std::cout << "instantiate empty int vector with first segment of 5 elements" << std::endl;
+		xstdtsl::safe_segmented_vector<int> cSSV(5);
+		std::cout << "confirm first segment size is rounded to 8" << std::endl;
+		assert(cSSV.first_segment_size() == 8);
+		std::cout << "confirm vector is empty with no capacity" << std::endl;
+		assert(cSSV.empty());
+		assert(cSSV.capacity() == 0);
+		std::cout << "push_back across several segments" << std::endl;
+		for (int iI = 0; iI < 1000; iI++)
+			cSSV.push_back(iI);
+		assert(cSSV.size() == 1000);
+		std::cout << "confirm capacity is the sum of doubling segments" << std::endl;
+		assert(cSSV.capacity() == 1016);
+		std::cout << "confirm contents" << std::endl;
+		for (int iI = 0; iI < 1000; iI++)
+			assert(cSSV.load(iI) == iI);
+		assert(cSSV.load(1000) == 0);
+		std::cout << "confirm element addresses are stable across growth" << std::endl;
+		{
+			xstdtsl::safe_segmented_vector<int>::write_control cWrite(cSSV);
+			cWrite.store(0,-1);
+		}
+		cSSV.reserve(100000);
+		assert(cSSV.capacity() >= 100000);
+		assert(cSSV.load(0) == -1);
+		std::cout << "find values in different segments" << std::endl;
+		assert(cSSV.find(7) == 7);
+		assert(cSSV.find(8) == 8);
+		assert(cSSV.find(999) == 999);
+		assert(cSSV.find(5,6) == 1000);
+		std::cout << "append a block spanning segments" << std::endl;
+		std::vector<int> vBlock(3000);
+		for (int iI = 0; iI < 3000; iI++)
+			vBlock[iI] = 1000 + iI;
+		cSSV.append(vBlock.data(),vBlock.size());
+		cSSV.append(vBlock.begin(),vBlock.begin() + 10);
+		assert(cSSV.size() == 4010);
+		assert(cSSV.load(3999) == 3999);
+		assert(cSSV.load(4009) == 1009);
+		std::cout << "load and store ranges spanning segments" << std::endl;
+		std::vector<int> vOut(100);
+		assert(cSSV.load_range(1000,100,vOut.data()) == 100);
+		for (int iI = 0; iI < 100; iI++)
+			assert(vOut[iI] == 1000 + iI);
+		assert(cSSV.store_range(4000,vOut.data(),100) == 10);
+		assert(cSSV.load(4009) == 1009);
+		std::cout << "copy the vector" << std::endl;
+		xstdtsl::safe_segmented_vector<int> cCopy(cSSV);
+		assert(cCopy.size() == cSSV.size());
+		for (size_t nI = 0; nI < cCopy.size(); nI++)
+			assert(cCopy.load(nI) == cSSV.load(nI));
+		std::cout << "resize, clear and shrink" << std::endl;
+		cSSV.resize(10);
+		assert(cSSV.size() == 10);
+		cSSV.shrink_to_fit();
+		assert(cSSV.capacity() == 24);
+		cSSV.resize(20,7);
+		assert(cSSV.load(19) == 7);
+		cSSV.clear();
+		assert(cSSV.empty());
+		cSSV.shrink_to_fit();
+		assert(cSSV.capacity() == 0);
+	}
+	{
+		std::cout << "vector of strings" << std::endl;
+		xstdtsl::safe_segmented_vector<std::string> cSSV = {"a","b"};
+		for (int iI = 0; iI < 500; iI++)
+			cSSV.emplace_back(10,(char)('a' + iI % 26));
+		cSSV.store(0,std::string("zz"));
+		assert(cSSV.size() == 502);
+		assert(cSSV.load(0) == "zz");
+		assert(cSSV.load(1) == "b");
+		assert(cSSV.load(3) == std::string(10,'b'));
+		assert(cSSV.find(std::string(10,'c')) == 4);
+		xstdtsl::safe_segmented_vector<std::string> cCopy;
+		cCopy = cSSV;
+		assert(cCopy.load(501) == cSSV.load(501));
+	}
+	{
+		std::cout << "a copy that throws partway through an append or resize leaves the vector unchanged" << std::endl;
+		{
+			xstdtsl::safe_segmented_vector<counted_copy> cSSV(4);
+			std::vector<counted_copy> vSource;
+			for (int iI = 0; iI < 10; iI++)
+				vSource.emplace_back(iI);
+			cSSV.append(vSource.data(),3);
+			int iLive = counted_copy::g_iLive;
+			bool bThrown = false;
+			counted_copy::g_iCopies_Left = 6;
+			try
+			{
+				cSSV.append(vSource.data(),10);
+			}
+			catch (const std::runtime_error &)
+			{
+				bThrown = true;
+			}
+			assert(bThrown);
+			assert(cSSV.size() == 3 && counted_copy::g_iLive == iLive);
+			bThrown = false;
+			counted_copy::g_iCopies_Left = 8; // one for the copy of the value, seven elements
+			try
+			{
+				cSSV.resize(20,counted_copy(7));
+			}
+			catch (const std::runtime_error &)
+			{
+				bThrown = true;
+			}
+			counted_copy::g_iCopies_Left = -1;
+			assert(bThrown);
+			assert(cSSV.size() == 3 && counted_copy::g_iLive == iLive);
+			assert(cSSV.load(2).m_iValue == 2);
+			cSSV.append(vSource.data(),10);
+			assert(cSSV.size() == 13 && cSSV.load(12).m_iValue == 9);
+		}
+		assert(counted_copy::g_iLive == 0);
+	}
+	{
+		std::cout << "read concurrently with appends" << std::endl;
+		xstdtsl::safe_segmented_vector<int64_t> cSSV(2);
+		std::atomic<bool> bDone(false);
+		std::thread cReader([&cSSV,&bDone]()
+		{
+			while (!bDone.load())
+			{
+				size_t nSize = cSSV.size();
+				for (size_t nI = 0; nI < nSize; nI += 97)
+					assert(cSSV.load(nI) == (int64_t)nI);
+				std::this_thread::yield();
+			}
+		});
+		for (int64_t iI = 0; iI < 200000; iI++)
+			cSSV.push_back(iI);
+		bDone = true;
+		cReader.join();
+		assert(cSSV.size() == 200000);
+	}
+	return 0;
+}
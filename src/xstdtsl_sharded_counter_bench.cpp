@@ -0,0 +1,67 @@
+#include <xstdtsl_sharded_counter>
+#include <thread>
+#include <atomic>
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <cstdlib>
+
+///
+/// run a number of threads that each perform a fixed number of increments
+/// \returns the elapsed time in seconds
+///
+template <class F> double run_threads(size_t i_nThreads, F i_fnWork)
+{
+	std::atomic<bool> bGo(false);
+	std::vector<std::thread> vThreads;
+	for (size_t nI = 0; nI < i_nThreads; nI++)
+	{
+		vThreads.emplace_back([&bGo,&i_fnWork]()
+		{
+			while (!bGo.load())
+				std::this_thread::yield();
+			i_fnWork();
+		});
+	}
+	auto tStart = std::chrono::steady_clock::now();
+	bGo = true;
+	for (auto & cThread : vThreads)
+		cThread.join();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+}
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	size_t nMax_Threads = 64;
+	int64_t iIncrements = 1000000;
+	if (i_nNum_Params > 1)
+		nMax_Threads = std::strtoul(i_pParams[1],nullptr,10);
+	if (i_nNum_Params > 2)
+		iIncrements = std::strtoll(i_pParams[2],nullptr,10);
+
+	std::cout << "--------------=============== sharded_counter scaling benchmark ===============--------------" << std::endl;
+	std::cout << "increments per thread: " << iIncrements << std::endl;
+	std::cout << "threads\tatomic Mops/s\tsharded Mops/s\tspeedup" << std::endl;
+	for (size_t nThreads = 1; nThreads <= nMax_Threads; nThreads *= 2)
+	{
+		alignas(XSTDTSL_CACHE_LINE_SIZE) std::atomic<int64_t> iAtomic(0);
+		double dAtomic = run_threads(nThreads,[&iAtomic,iIncrements]()
+		{
+			for (int64_t iI = 0; iI < iIncrements; iI++)
+				iAtomic.fetch_add(1,std::memory_order_relaxed);
+		});
+
+		xstdtsl::sharded_counter cSharded;
+		double dSharded = run_threads(nThreads,[&cSharded,iIncrements]()
+		{
+			for (int64_t iI = 0; iI < iIncrements; iI++)
+				cSharded.increment();
+		});
+		if (iAtomic.load() != cSharded.load())
+			std::cout << "count mismatch: " << iAtomic.load() << " vs " << cSharded.load() << std::endl;
+
+		double dOps = (double)nThreads * (double)iIncrements * 1.0e-6;
+		std::cout << nThreads << "\t" << dOps / dAtomic << "\t" << dOps / dSharded << "\t" << dAtomic / dSharded << std::endl;
+	}
+	return 0;
+}
@@ -0,0 +1,75 @@
+#include <xstdtsl_sharded_counter>
+#include <thread>
+#include <atomic>
+#include <iostream>
+#include <chrono>
+#include <cassert>
+#include <vector>
+
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	std::cout << "--------------=============== sharded_counter tests ===============--------------" << std::endl;
+	{
+		std::cout << "construct sharded_counter with default parameters" << std::endl;
+		xstdtsl::sharded_counter cCounter;
+		std::cout << "confirm shard count is a power of two" << std::endl;
+		assert(cCounter.shards() > 0 && (cCounter.shards() & (cCounter.shards() - 1)) == 0);
+		std::cout << "confirm initial count is 0" << std::endl;
+		assert(cCounter.load() == 0);
+		assert(cCounter.load_approximate() == 0);
+		std::cout << "increment, decrement, add and subtract" << std::endl;
+		cCounter.increment();
+		cCounter.increment();
+		cCounter.decrement();
+		cCounter.add(10);
+		cCounter.sub(3);
+		std::cout << "confirm exact count" << std::endl;
+		assert(cCounter.load() == 8);
+		std::cout << "confirm approximate count is within the batch error" << std::endl;
+		assert(cCounter.load_approximate() <= 8);
+		std::cout << "store a value" << std::endl;
+		cCounter.store(100);
+		assert(cCounter.load() == 100);
+		assert(cCounter.load_approximate() == 100);
+	}
+	{
+		std::cout << "construct sharded_counter with 3 shards and batch 1" << std::endl;
+		xstdtsl::sharded_counter cCounter(3,1);
+		std::cout << "confirm shard count is rounded to 4" << std::endl;
+		assert(cCounter.shards() == 4);
+		std::cout << "confirm approximate count is exact with batch 1" << std::endl;
+		for (int iI = 0; iI < 10; iI++)
+			cCounter.increment();
+		assert(cCounter.load_approximate() == 10);
+		cCounter.sub(4);
+		assert(cCounter.load_approximate() == 6);
+		assert(cCounter.load() == 6);
+	}
+	{
+		std::cout << "increment from 8 threads concurrently" << std::endl;
+		xstdtsl::sharded_counter cCounter(4,16);
+		std::vector<std::thread> vThreads;
+		const int64_t iPer_Thread = 100000;
+		for (size_t nI = 0; nI < 8; nI++)
+		{
+			vThreads.emplace_back([&cCounter,iPer_Thread,nI]()
+			{
+				for (int64_t iI = 0; iI < iPer_Thread; iI++)
+				{
+					if (nI & 1)
+						cCounter.add(3);
+					else
+						cCounter.increment();
+				}
+			});
+		}
+		for (auto & cThread : vThreads)
+			cThread.join();
+		std::cout << "confirm exact count after threads complete" << std::endl;
+		assert(cCounter.load() == 4 * iPer_Thread + 4 * 3 * iPer_Thread);
+		std::cout << "confirm approximate count error is bounded" << std::endl;
+		assert(cCounter.load() - cCounter.load_approximate() < (int64_t)cCounter.shards() * 16);
+	}
+	return 0;
+}
@@ -0,0 +1,99 @@
+#include <xstdtsl_safe_vector>
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include <cstdlib>
+#include <cstdint>
+
+///
+/// the number of allocations made through counting_allocator
+///
+static size_t g_nAllocations = 0;
+
+///
+/// standard allocator that counts its allocations
+///
+template <class T> class counting_allocator : public std::allocator<T>
+{
+public:
+	typedef T value_type;
+
+	counting_allocator(void) noexcept
+	{
+	}
+	template <class U> counting_allocator(const counting_allocator<U> &) noexcept
+	{
+	}
+	T * allocate(size_t i_nCount)
+	{
+		g_nAllocations++;
+		return std::allocator<T>::allocate(i_nCount);
+	}
+	void deallocate(T * i_pData, size_t i_nCount) noexcept
+	{
+		std::allocator<T>::deallocate(i_pData,i_nCount);
+	}
+	template <class U> bool operator ==(const counting_allocator<U> &) const noexcept
+	{
+		return true;
+	}
+	template <class U> bool operator !=(const counting_allocator<U> &) const noexcept
+	{
+		return false;
+	}
+};
+
+///
+/// create, fill and destroy many short lived vectors
+/// \returns the average time per vector in nanoseconds
+///
+template <class V> double vector_latency(
+	size_t i_nVectors, ///< the number of vectors to create
+	size_t i_nElements ///< the number of elements to place in each vector
+	)
+{
+	volatile uint64_t uSink = 0;
+	auto tStart = std::chrono::steady_clock::now();
+	for (size_t nV = 0; nV < i_nVectors; nV++)
+	{
+		V cVector;
+		for (size_t nI = 0; nI < i_nElements; nI++)
+			cVector.push_back((uint64_t)(nV + nI));
+		uSink = uSink + cVector.load(i_nElements - 1);
+	}
+	return std::chrono::duration<double,std::nano>(std::chrono::steady_clock::now() - tStart).count() / (double)i_nVectors;
+}
+
+///
+/// count the allocations made while creating, filling and destroying many short lived vectors
+/// \returns the average number of allocations per vector
+///
+template <class V> double vector_allocations(
+	size_t i_nVectors, ///< the number of vectors to create
+	size_t i_nElements ///< the number of elements to place in each vector
+	)
+{
+	g_nAllocations = 0;
+	vector_latency<V>(i_nVectors,i_nElements);
+	return (double)g_nAllocations / (double)i_nVectors;
+}
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	size_t nVectors = 1000000;
+	if (i_nNum_Params > 1)
+		nVectors = std::strtoul(i_pParams[1],nullptr,10);
+
+	std::cout << "--------------=============== small vector benchmark ===============--------------" << std::endl;
+	std::cout << "vectors: " << nVectors << " element type: uint64_t" << std::endl;
+	std::cout << "elements\tallocations (inline 0)\tallocations (inline 8)\tns per vector (inline 0)\tns per vector (inline 8)" << std::endl;
+	for (size_t nElements : {1, 4, 8, 9, 16})
+	{
+		double dAlloc_Heap = vector_allocations<xstdtsl::safe_vector<uint64_t,counting_allocator<uint64_t>>>(nVectors,nElements);
+		double dAlloc_Inline = vector_allocations<xstdtsl::safe_vector<uint64_t,counting_allocator<uint64_t>,0,8>>(nVectors,nElements);
+		double dHeap = vector_latency<xstdtsl::safe_vector<uint64_t>>(nVectors,nElements);
+		double dInline = vector_latency<xstdtsl::small_safe_vector<uint64_t,8>>(nVectors,nElements);
+		std::cout << nElements << "\t" << dAlloc_Heap << "\t" << dAlloc_Inline << "\t" << dHeap << "\t" << dInline << std::endl;
+	}
+	return 0;
+}
@@ -0,0 +1,143 @@
+#include <xstdtsl_safe_vector>
+#include <xstdtsl_safe_snapshot_vector>
+#include <thread>
+#include <atomic>
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <cstdint>
+
+///
+/// run reader threads for a fixed time while the calling thread performs updates at a fixed interval
+/// \returns the total number of reads performed by all readers
+///
+template <class R, class W> uint64_t run_readers(size_t i_nThreads, double i_dSeconds, double i_dUpdate_Interval, R i_fnRead, W i_fnUpdate, std::vector<double> & o_vUpdate_Latency)
+{
+	std::atomic<bool> bDone(false);
+	std::atomic<uint64_t> nReads(0);
+	std::vector<std::thread> vThreads;
+	for (size_t nI = 0; nI < i_nThreads; nI++)
+	{
+		vThreads.emplace_back([&bDone,&nReads,&i_fnRead,nI]()
+		{
+			uint64_t nLocal = 0;
+			size_t nIndex = nI * 7919;
+			while (!bDone.load(std::memory_order_relaxed))
+			{
+				for (size_t nJ = 0; nJ < 64; nJ++)
+				{
+					i_fnRead(nIndex);
+					nIndex += 4099;
+				}
+				nLocal += 64;
+			}
+			nReads += nLocal;
+		});
+	}
+	auto tStart = std::chrono::steady_clock::now();
+	auto tNext = tStart;
+	o_vUpdate_Latency.clear();
+	while (std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count() < i_dSeconds)
+	{
+		tNext += std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(i_dUpdate_Interval));
+		std::this_thread::sleep_until(tNext);
+		auto tUpdate = std::chrono::steady_clock::now();
+		i_fnUpdate();
+		o_vUpdate_Latency.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - tUpdate).count());
+	}
+	bDone = true;
+	for (auto & cThread : vThreads)
+		cThread.join();
+	return nReads.load();
+}
+
+///
+/// get a percentile of a set of samples
+/// \returns the selected percentile in microseconds
+///
+double percentile(std::vector<double> i_vSamples, double i_dFraction)
+{
+	double dRet = 0.0;
+	if (!i_vSamples.empty())
+	{
+		std::sort(i_vSamples.begin(),i_vSamples.end());
+		dRet = i_vSamples[(size_t)(i_dFraction * (double)(i_vSamples.size() - 1))] * 1.0e6;
+	}
+	return dRet;
+}
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	size_t nMax_Threads = 16;
+	size_t nElements = 1 << 20;
+	double dSeconds = 1.0;
+	if (i_nNum_Params > 1)
+		nMax_Threads = std::strtoul(i_pParams[1],nullptr,10);
+	if (i_nNum_Params > 2)
+		nElements = std::strtoul(i_pParams[2],nullptr,10);
+	if (i_nNum_Params > 3)
+		dSeconds = std::strtod(i_pParams[3],nullptr);
+	const double dUpdate_Interval = 0.001;
+
+	std::vector<int64_t> vData(nElements);
+	for (size_t nI = 0; nI < nElements; nI++)
+		vData[nI] = (int64_t)nI;
+	xstdtsl::safe_vector<int64_t> cLocked;
+	cLocked.append(vData.data(),vData.size());
+	xstdtsl::safe_snapshot_vector<int64_t> cSnapshot;
+	cSnapshot.publish(vData.data(),vData.size());
+
+	std::cout << "--------------=============== read-mostly snapshot benchmark ===============--------------" << std::endl;
+	std::cout << "elements: " << nElements << " update interval: " << dUpdate_Interval * 1.0e3 << " ms, one element per update" << std::endl;
+	std::cout << "threads\tsafe_vector Mreads/s\tsafe_snapshot_vector Mreads/s\tsafe_vector update p50 us\tsafe_vector update p99 us\tsafe_snapshot_vector update p50 us\tsafe_snapshot_vector update p99 us" << std::endl;
+	for (size_t nThreads = 1; nThreads <= nMax_Threads; nThreads *= 2)
+	{
+		std::atomic<int64_t> iSink(0);
+		int64_t iUpdate = 0;
+		std::vector<double> vLocked_Latency;
+		uint64_t nLocked = run_readers(nThreads,dSeconds,dUpdate_Interval,[&cLocked,&iSink,nElements](size_t i_nIndex)
+		{
+			if (cLocked.load(i_nIndex % nElements) == -1)
+				iSink++;
+		},[&cLocked,&iUpdate,nElements]()
+		{
+			cLocked.store((size_t)(iUpdate * 31) % nElements,iUpdate);
+			iUpdate++;
+		},vLocked_Latency);
+
+		std::vector<double> vSnapshot_Latency;
+		uint64_t nSnapshot = run_readers(nThreads,dSeconds,dUpdate_Interval,[&cSnapshot,&iSink,nElements](size_t i_nIndex)
+		{
+			auto cSnap = cSnapshot.get_snapshot();
+			if (cSnap[i_nIndex % nElements] == -1)
+				iSink++;
+		},[&cSnapshot,&iUpdate,nElements]()
+		{
+			cSnapshot.store((size_t)(iUpdate * 31) % nElements,iUpdate);
+			iUpdate++;
+		},vSnapshot_Latency);
+
+		std::cout << nThreads << "\t" << (double)nLocked * 1.0e-6 / dSeconds << "\t" << (double)nSnapshot * 1.0e-6 / dSeconds;
+		std::cout << "\t" << percentile(vLocked_Latency,0.5) << "\t" << percentile(vLocked_Latency,0.99);
+		std::cout << "\t" << percentile(vSnapshot_Latency,0.5) << "\t" << percentile(vSnapshot_Latency,0.99) << std::endl;
+	}
+
+	std::cout << "--------------=============== snapshot update latency benchmark ===============--------------" << std::endl;
+	std::cout << "segment size\tsingle element update us\tfull republish us" << std::endl;
+	for (size_t nSegment_Size = 256; nSegment_Size <= 65536; nSegment_Size *= 4)
+	{
+		xstdtsl::safe_snapshot_vector<int64_t> cVector(nSegment_Size);
+		auto tStart = std::chrono::steady_clock::now();
+		cVector.publish(vData.data(),vData.size());
+		double dPublish = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+		const size_t nUpdates = 1000;
+		tStart = std::chrono::steady_clock::now();
+		for (size_t nI = 0; nI < nUpdates; nI++)
+			cVector.store((nI * 7919) % nElements,(int64_t)nI);
+		double dUpdate = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count() / (double)nUpdates;
+		std::cout << nSegment_Size << "\t" << dUpdate * 1.0e6 << "\t" << dPublish * 1.0e6 << std::endl;
+	}
+	return 0;
+}
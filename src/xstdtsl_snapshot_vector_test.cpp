@@ -0,0 +1,225 @@
+#include <xstdtsl_safe_snapshot_vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <cstdint>
+
+///
+/// element type that tracks live instances and whose copy constructor throws once the copy budget is spent
+///
+class counted_copy
+{
+public:
+	static int g_iLive; ///< number of instances alive
+	static int g_iCopies_Left; ///< copies allowed before the copy constructor throws; negative for no limit
+	int m_iValue; ///< the value held
+
+	explicit counted_copy(int i_iValue = 0) noexcept : m_iValue(i_iValue) { g_iLive++; }
+	counted_copy(const counted_copy & i_cRHO) noexcept(false) : m_iValue(i_cRHO.m_iValue)
+	{
+		if (g_iCopies_Left == 0)
+			throw std::runtime_error("copy");
+		if (g_iCopies_Left > 0)
+			g_iCopies_Left--;
+		g_iLive++;
+	}
+	counted_copy & operator =(const counted_copy & i_cRHO) noexcept { m_iValue = i_cRHO.m_iValue; return *this; }
+	bool operator ==(const counted_copy & i_cRHO) const noexcept { return m_iValue == i_cRHO.m_iValue; }
+	~counted_copy(void) noexcept { g_iLive--; }
+};
+int counted_copy::g_iLive = 0;
+int counted_copy::g_iCopies_Left = -1;
+///
+/// element type aligned beyond the alignment of std::max_align_t
+///
+struct alignas(128) over_aligned
+{
+	int64_t m_iValue; ///< the value held
+	bool operator ==(const over_aligned & i_cRHO) const noexcept { return m_iValue == i_cRHO.m_iValue; }
+};
+
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	std::cout << "--------------=============== safe_snapshot_vector tests ===============--------------" << std::endl;
+	{
+		std::cout << "instantiate empty int vector" << std::endl;
+		xstdtsl::safe_snapshot_vector<int> cSSV(16);
+		assert(cSSV.empty());
+		assert(cSSV.segment_size() == 16);
+		std::cout << "publish a block" << std::endl;
+		std::vector<int> vData(100);
+		for (int iI = 0; iI < 100; iI++)
+			vData[iI] = iI;
+		cSSV.publish(vData.data(),vData.size());
+		assert(cSSV.size() == 100);
+		assert(cSSV.load(42) == 42);
+		assert(cSSV.load(100) == 0);
+		std::cout << "confirm a snapshot is unchanged by a concurrent update" << std::endl;
+		{
+			auto cOld = cSSV.get_snapshot();
+			std::atomic<bool> bPublished(false);
+			std::thread cWriter([&cSSV,&bPublished]()
+			{
+				cSSV.store(5,-5);
+				bPublished = true;
+			});
+			// the writer swaps in the new snapshot, then waits for this handle to be released
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+			assert(!bPublished.load());
+			assert(cOld.size() == 100);
+			assert(cOld[5] == 5);
+			{
+				auto cMoved = std::move(cOld);
+				assert(cOld.empty());
+				assert(cMoved[5] == 5);
+			}
+			cWriter.join();
+			assert(bPublished.load());
+		}
+		cSSV.push_back(100);
+		{
+			auto cNew = cSSV.get_snapshot();
+			assert(cNew.size() == 101);
+			assert(cNew[5] == -5);
+			assert(cNew[100] == 100);
+		}
+		std::cout << "find and load_range across segments" << std::endl;
+		{
+			auto cSnap = cSSV.get_snapshot();
+			assert(cSnap.find(42) == 42);
+			assert(cSnap.find(-5) == 5);
+			assert(cSnap.find(5) == cSnap.size());
+			assert(cSnap.find(100,50) == 100);
+			std::vector<int> vOut(40);
+			assert(cSnap.load_range(10,40,vOut.data()) == 40);
+			for (int iI = 0; iI < 40; iI++)
+				assert(vOut[iI] == (iI + 10 == 5 ? -5 : iI + 10));
+			assert(cSnap.load_range(90,40,vOut.data()) == 11);
+			assert(vOut[10] == 100);
+		}
+		std::cout << "stage several changes and publish once" << std::endl;
+		{
+			xstdtsl::safe_snapshot_vector<int>::write_control cWrite(cSSV);
+			cWrite.resize(20);
+			assert(cWrite.size() == 20);
+			assert(cSSV.size() == 101);
+			cWrite.store(19,19);
+			cWrite.push_back(20);
+			assert(cWrite.load(20) == 20);
+			cWrite.commit();
+			assert(cSSV.size() == 21);
+			cWrite.push_back(99);
+			cWrite.discard();
+			assert(cSSV.size() == 21);
+			cWrite.resize(40,7);
+		}
+		assert(cSSV.size() == 40);
+		assert(cSSV.load(39) == 7);
+		assert(cSSV.load(20) == 20);
+		std::cout << "an exception leaving the scope discards the draft" << std::endl;
+		try
+		{
+			xstdtsl::safe_snapshot_vector<int>::write_control cWrite(cSSV);
+			cWrite.store(0,-1);
+			cWrite.push_back(41);
+			throw std::runtime_error("abandon");
+		}
+		catch (const std::runtime_error &)
+		{
+		}
+		assert(cSSV.size() == 40);
+		assert(cSSV.load(0) == 0);
+		cSSV.clear();
+		assert(cSSV.empty());
+	}
+	{
+		std::cout << "copy on write of string segments" << std::endl;
+		xstdtsl::safe_snapshot_vector<std::string> cSSV(4);
+		{
+			xstdtsl::safe_snapshot_vector<std::string>::write_control cWrite(cSSV);
+			for (int iI = 0; iI < 10; iI++)
+				cWrite.push_back(std::string(3,(char)('a' + iI)));
+		}
+		cSSV.store(9,"zzz");
+		assert(cSSV.load(9) == "zzz");
+		assert(cSSV.load(0) == "aaa");
+		assert(cSSV.get_snapshot().find(std::string("ccc")) == 2);
+		cSSV.push_back(std::string("end"));
+		assert(cSSV.size() == 11);
+	}
+	{
+		std::cout << "a copy that throws while copying a shared segment leaves the vector unchanged" << std::endl;
+		{
+			xstdtsl::safe_snapshot_vector<counted_copy> cSSV(4);
+			for (int iI = 0; iI < 6; iI++)
+				cSSV.push_back(counted_copy(iI));
+			int iLive = counted_copy::g_iLive;
+			bool bThrown = false;
+			counted_copy::g_iCopies_Left = 2;
+			try
+			{
+				cSSV.store(1,counted_copy(9));
+			}
+			catch (const std::runtime_error &)
+			{
+				bThrown = true;
+			}
+			counted_copy::g_iCopies_Left = -1;
+			assert(bThrown);
+			assert(counted_copy::g_iLive == iLive);
+			assert(cSSV.size() == 6 && cSSV.load(1).m_iValue == 1);
+			cSSV.store(1,counted_copy(9));
+			assert(cSSV.load(1).m_iValue == 9 && cSSV.load(3).m_iValue == 3);
+		}
+		assert(counted_copy::g_iLive == 0);
+		std::cout << "segments of an over-aligned type are aligned" << std::endl;
+		xstdtsl::safe_snapshot_vector<over_aligned> cSSV(4);
+		for (int64_t iI = 0; iI < 10; iI++)
+			cSSV.push_back(over_aligned{iI});
+		auto cSnapshot = cSSV.get_snapshot();
+		for (size_t nI = 0; nI < cSnapshot.size(); nI++)
+		{
+			assert(reinterpret_cast<uintptr_t>(&cSnapshot[nI]) % alignof(over_aligned) == 0);
+			assert(cSnapshot[nI].m_iValue == (int64_t)nI);
+		}
+	}
+	{
+		std::cout << "readers and a writer concurrently" << std::endl;
+		xstdtsl::safe_snapshot_vector<int64_t> cSSV(64);
+		std::vector<int64_t> vData(1000,0);
+		cSSV.publish(vData.data(),vData.size());
+		std::atomic<bool> bDone(false);
+		std::vector<std::thread> vReaders;
+		for (int iT = 0; iT < 4; iT++)
+		{
+			vReaders.emplace_back([&cSSV,&bDone]()
+			{
+				while (!bDone.load())
+				{
+					auto cSnap = cSSV.get_snapshot();
+					// every update writes the same value to all elements, so a snapshot is uniform
+					int64_t iFirst = cSnap[0];
+					for (size_t nI = 0; nI < cSnap.size(); nI += 37)
+						assert(cSnap[nI] == iFirst);
+				}
+			});
+		}
+		for (int64_t iValue = 1; iValue <= 200; iValue++)
+		{
+			xstdtsl::safe_snapshot_vector<int64_t>::write_control cWrite(cSSV);
+			for (size_t nI = 0; nI < 1000; nI++)
+				cWrite.store(nI,iValue);
+		}
+		bDone = true;
+		for (auto & cThread : vReaders)
+			cThread.join();
+		assert(cSSV.load(999) == 200);
+	}
+	return 0;
+}
@@ -0,0 +1,136 @@
+#include <xstdtsl_safe_soa_vector>
+#include <xstdtsl_safe_vector>
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <cstdint>
+#include <vector>
+
+///
+/// a record as it would be stored as an array of structures
+///
+struct trade
+{
+	int64_t	m_iId;
+	double	m_dPrice;
+	int32_t	m_iQuantity;
+	int32_t	m_iFlags;
+	char	m_chSymbol[16];
+};
+
+///
+/// time repeated passes of a function
+/// \returns the mean time of one pass in milliseconds
+///
+template <class F> double time_pass(size_t i_nPasses, F i_fnPass)
+{
+	auto tStart = std::chrono::steady_clock::now();
+	for (size_t nI = 0; nI < i_nPasses; nI++)
+		i_fnPass();
+	return std::chrono::duration<double,std::milli>(std::chrono::steady_clock::now() - tStart).count() / (double)i_nPasses;
+}
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	size_t nMax_Records = 8 * 1024 * 1024;
+	size_t nPasses = 10;
+	if (i_nNum_Params > 1)
+		nMax_Records = std::strtoul(i_pParams[1],nullptr,10);
+	if (i_nNum_Params > 2)
+		nPasses = std::strtoul(i_pParams[2],nullptr,10);
+	volatile double dSink = 0.0;
+	volatile size_t nSink = 0;
+
+	std::cout << "--------------=============== field scan: structure of arrays vs array of structures ===============--------------" << std::endl;
+	std::cout << "record bytes: " << sizeof(trade) << "; GB/s counts only the bytes of the scanned field" << std::endl;
+	std::cout << "records\tscan\tAoS std::vector ms\tAoS safe_vector read_control ms\tSoA reduce_field ms\tSoA span ms\tAoS std::vector GB/s\tSoA reduce_field GB/s" << std::endl;
+	for (size_t nRecords = 64 * 1024; nRecords <= nMax_Records; nRecords *= 8)
+	{
+		std::vector<trade> vAoS(nRecords);
+		xstdtsl::safe_vector<trade> cAoS;
+		xstdtsl::safe_soa_vector<int64_t,double,int32_t,int32_t> cSoA;
+		cSoA.reserve(nRecords);
+		for (size_t nI = 0; nI < nRecords; nI++)
+		{
+			trade & cTrade = vAoS[nI];
+			cTrade.m_iId = (int64_t)nI;
+			cTrade.m_dPrice = (double)(nI % 1000) * 0.25;
+			cTrade.m_iQuantity = (int32_t)(nI % 97);
+			cTrade.m_iFlags = 0;
+			cSoA.push_back(cTrade.m_iId,cTrade.m_dPrice,cTrade.m_iQuantity,cTrade.m_iFlags);
+		}
+		cAoS.append(vAoS.data(),vAoS.size());
+		double dPrice_Bytes = (double)(nRecords * sizeof(double));
+		double dQuantity_Bytes = (double)(nRecords * sizeof(int32_t));
+
+		// sum of the price field
+		double dAoS = time_pass(nPasses,[&]()
+		{
+			double dSum = 0.0;
+			for (const trade & cTrade : vAoS)
+				dSum += cTrade.m_dPrice;
+			dSink = dSink + dSum;
+		});
+		double dAoS_Safe = time_pass(nPasses,[&]()
+		{
+			double dSum = 0.0;
+			xstdtsl::safe_vector<trade>::read_control cRead(cAoS);
+			for (size_t nI = 0; nI < cRead.size(); nI++)
+				dSum += cRead.load(nI).m_dPrice;
+			dSink = dSink + dSum;
+		});
+		double dSoA = time_pass(nPasses,[&]() { dSink = dSink + cSoA.reduce_field<1>(0.0); });
+		double dSoA_Span = time_pass(nPasses,[&]()
+		{
+			double dSum = 0.0;
+			decltype(cSoA)::read_control cRead(cSoA);
+			for (double dPrice : cRead.field<1>())
+				dSum += dPrice;
+			dSink = dSink + dSum;
+		});
+		std::cout << nRecords << "\tsum price\t" << dAoS << "\t" << dAoS_Safe << "\t" << dSoA << "\t" << dSoA_Span << "\t" << dPrice_Bytes / dAoS * 1.0e-6 << "\t" << dPrice_Bytes / dSoA * 1.0e-6 << std::endl;
+
+		// count of records with a small quantity; integral, so the column loop vectorizes
+		dAoS = time_pass(nPasses,[&]()
+		{
+			size_t nCount = 0;
+			for (const trade & cTrade : vAoS)
+				nCount += cTrade.m_iQuantity < 10 ? 1 : 0;
+			nSink = nSink + nCount;
+		});
+		dAoS_Safe = time_pass(nPasses,[&]()
+		{
+			size_t nCount = 0;
+			xstdtsl::safe_vector<trade>::read_control cRead(cAoS);
+			for (size_t nI = 0; nI < cRead.size(); nI++)
+				nCount += cRead.load(nI).m_iQuantity < 10 ? 1 : 0;
+			nSink = nSink + nCount;
+		});
+		dSoA = time_pass(nPasses,[&]() { nSink = nSink + cSoA.count_if_field<2>([](int32_t i_iQuantity) { return i_iQuantity < 10; }); });
+		dSoA_Span = time_pass(nPasses,[&]()
+		{
+			size_t nCount = 0;
+			decltype(cSoA)::read_control cRead(cSoA);
+			for (int32_t iQuantity : cRead.field<2>())
+				nCount += iQuantity < 10 ? 1 : 0;
+			nSink = nSink + nCount;
+		});
+		std::cout << nRecords << "\tcount quantity\t" << dAoS << "\t" << dAoS_Safe << "\t" << dSoA << "\t" << dSoA_Span << "\t" << dQuantity_Bytes / dAoS * 1.0e-6 << "\t" << dQuantity_Bytes / dSoA * 1.0e-6 << std::endl;
+
+		// find of an id; the column uses the vector kernel, the records a strided compare
+		int64_t iTarget = (int64_t)nRecords - 1;
+		dAoS = time_pass(nPasses,[&]()
+		{
+			size_t nFound = nRecords;
+			for (size_t nI = 0; nI < nRecords && nFound == nRecords; nI++)
+			{
+				if (vAoS[nI].m_iId == iTarget)
+					nFound = nI;
+			}
+			nSink = nSink + nFound;
+		});
+		dSoA = time_pass(nPasses,[&]() { nSink = nSink + cSoA.find<0>(iTarget); });
+		std::cout << nRecords << "\tfind id\t" << dAoS << "\t-\t" << dSoA << "\t-\t" << dPrice_Bytes / dAoS * 1.0e-6 << "\t" << dPrice_Bytes / dSoA * 1.0e-6 << std::endl;
+	}
+	return 0;
+}
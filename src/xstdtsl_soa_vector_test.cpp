@@ -0,0 +1,250 @@
+#include <xstdtsl_safe_soa_vector>
+#include <thread>
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+///
+/// field type that tracks live instances and whose constructors throw once the construction budget is spent
+///
+class fragile_field
+{
+public:
+	static int g_iLive; ///< number of instances alive
+	static int g_iBudget; ///< constructions allowed before a constructor throws; negative for no limit
+	int m_iValue; ///< the value held
+
+	static void spend(void) noexcept(false)
+	{
+		if (g_iBudget == 0)
+			throw std::runtime_error("construct");
+		if (g_iBudget > 0)
+			g_iBudget--;
+	}
+	fragile_field(void) noexcept(false) : m_iValue(0) { spend(); g_iLive++; }
+	explicit fragile_field(int i_iValue) noexcept : m_iValue(i_iValue) { g_iLive++; }
+	fragile_field(const fragile_field & i_cRHO) noexcept(false) : m_iValue(i_cRHO.m_iValue) { spend(); g_iLive++; }
+	fragile_field & operator =(const fragile_field & i_cRHO) noexcept { m_iValue = i_cRHO.m_iValue; return *this; }
+	bool operator ==(const fragile_field & i_cRHO) const noexcept { return m_iValue == i_cRHO.m_iValue; }
+	~fragile_field(void) noexcept { g_iLive--; }
+};
+int fragile_field::g_iLive = 0;
+int fragile_field::g_iBudget = -1;
+
+///
+/// run a function that is expected to throw std::runtime_error with a construction budget
+/// \returns true if the function threw
+///
+template <class F> static bool throws_with_budget(int i_iBudget, F i_fnFunction)
+{
+	bool bRet = false;
+	fragile_field::g_iBudget = i_iBudget;
+	try
+	{
+		i_fnFunction();
+	}
+	catch (const std::runtime_error &)
+	{
+		bRet = true;
+	}
+	fragile_field::g_iBudget = -1;
+	return bRet;
+}
+
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	std::cout << "--------------=============== safe_soa_vector tests ===============--------------" << std::endl;
+	{
+		std::cout << "instantiate empty vector of (int64_t, double, int32_t)" << std::endl;
+		xstdtsl::safe_soa_vector<int64_t,double,int32_t> cSOA;
+		assert(cSOA.empty());
+		assert(cSOA.capacity() == 0);
+		assert(decltype(cSOA)::g_nFields == 3);
+		std::cout << "push_back records beyond the initial capacity" << std::endl;
+		for (int64_t iI = 0; iI < 1000; iI++)
+			cSOA.push_back(iI,iI * 0.5,(int32_t)(iI % 7));
+		cSOA.push_back(std::make_tuple((int64_t)1000,500.0,(int32_t)(1000 % 7)));
+		assert(cSOA.size() == 1001);
+		assert(cSOA.capacity() >= 1001);
+		std::cout << "confirm records and fields" << std::endl;
+		for (int64_t iI = 0; iI <= 1000; iI++)
+		{
+			auto tRow = cSOA.load(iI);
+			assert(std::get<0>(tRow) == iI);
+			assert(std::get<1>(tRow) == iI * 0.5);
+			assert(std::get<2>(tRow) == iI % 7);
+			assert(cSOA.load_field<1>(iI) == iI * 0.5);
+		}
+		assert(cSOA.load(1001) == std::make_tuple((int64_t)0,0.0,(int32_t)0));
+		assert(cSOA.load_field<0>(1001) == 0);
+		std::cout << "confirm each column is cache line aligned" << std::endl;
+		{
+			decltype(cSOA)::read_control cRead(cSOA);
+			size_t nLine = xstdtsl_get_cache_line_size();
+			assert(reinterpret_cast<uintptr_t>(cRead.field<0>().data()) % nLine == 0);
+			assert(reinterpret_cast<uintptr_t>(cRead.field<1>().data()) % nLine == 0);
+			assert(reinterpret_cast<uintptr_t>(cRead.field<2>().data()) % nLine == 0);
+		}
+		std::cout << "store records and fields" << std::endl;
+		cSOA.store(10,std::make_tuple((int64_t)-10,-5.0,(int32_t)-1));
+		cSOA.store_field<2>(11,(int32_t)-2);
+		cSOA.store(2000,std::make_tuple((int64_t)1,1.0,(int32_t)1));
+		cSOA.store_field<0>(2000,(int64_t)1);
+		assert(cSOA.load(10) == std::make_tuple((int64_t)-10,-5.0,(int32_t)-1));
+		assert(cSOA.load_field<2>(11) == -2);
+		assert(cSOA.load_field<0>(11) == 11);
+		assert(cSOA.size() == 1001);
+		std::cout << "column scans" << std::endl;
+		assert(cSOA.find<0>((int64_t)500) == 500);
+		assert(cSOA.find<0>((int64_t)-10) == 10);
+		assert(cSOA.find<0>((int64_t)5,6) == 1001);
+		assert(cSOA.find<2>((int32_t)-2) == 11);
+		assert(cSOA.find<1>(250.0) == 500);
+		assert(cSOA.find<1>(0.25) == 1001);
+		int64_t iSum = 0;
+		for (int64_t iI = 0; iI <= 1000; iI++)
+			iSum += iI;
+		assert(cSOA.reduce_field<0>((int64_t)0) == iSum - 20);
+		assert(cSOA.reduce_field<1>(0.0) == (double)iSum * 0.5 - 10.0);
+		assert(cSOA.reduce_field<0>(INT64_MIN,[](int64_t i_iA, int64_t i_iB){return i_iA > i_iB ? i_iA : i_iB;}) == 1000);
+		assert(cSOA.count_if_field<2>([](int32_t i_iV){return i_iV < 0;}) == 2);
+		size_t nVisited = 0;
+		cSOA.for_each_field<1>([&nVisited](const double &){nVisited++;});
+		assert(nVisited == 1001);
+		std::cout << "load a run of one field" << std::endl;
+		{
+			std::vector<double> vPrices(20);
+			assert(cSOA.load_field_range<1>(990,20,vPrices.data()) == 11);
+			assert(vPrices[0] == 495.0);
+			assert(vPrices[10] == 500.0);
+			assert(cSOA.load_field_range<1>(1001,5,vPrices.data()) == 0);
+		}
+		std::cout << "spans through controls" << std::endl;
+		{
+			decltype(cSOA)::read_control cRead(cSOA);
+			xstdtsl::span<const double> cPrices = cRead.field<1>();
+			assert(cPrices.size() == 1001);
+			assert(cPrices.size_bytes() == 1001 * sizeof(double));
+			assert(cPrices[20] == 10.0);
+			double dSum = 0.0;
+			for (double dPrice : cPrices.subspan(0,4))
+				dSum += dPrice;
+			assert(dSum == 0.0 + 0.5 + 1.0 + 1.5);
+			assert(cPrices.subspan(1000,10).size() == 1);
+			assert(cPrices.subspan(1001).empty());
+			assert(cRead.find<0>((int64_t)7) == 7);
+			assert(std::get<0>(cRead.load(7)) == 7);
+		}
+		{
+			decltype(cSOA)::write_control cWrite(cSOA);
+			xstdtsl::span<int32_t> cQuantities = cWrite.field<2>();
+			for (int32_t & iQuantity : cQuantities)
+				iQuantity = 3;
+			cWrite.push_back(1001,500.5,4);
+			assert(cWrite.size() == 1002);
+			cWrite.store(0,std::make_tuple((int64_t)0,0.0,(int32_t)9));
+		}
+		assert(cSOA.count_if_field<2>([](int32_t i_iV){return i_iV == 3;}) == 1000);
+		assert(cSOA.load_field<2>(0) == 9);
+		assert(cSOA.load_field<2>(1001) == 4);
+		std::cout << "resize, reserve, shrink_to_fit and clear" << std::endl;
+		cSOA.resize(10);
+		assert(cSOA.size() == 10);
+		cSOA.resize(12);
+		assert(cSOA.load(11) == std::make_tuple((int64_t)0,0.0,(int32_t)0));
+		assert(cSOA.load_field<0>(9) == 9);
+		cSOA.shrink_to_fit();
+		assert(cSOA.capacity() == 12);
+		cSOA.reserve(100);
+		assert(cSOA.capacity() == 100);
+		assert(cSOA.load_field<0>(9) == 9);
+		cSOA.clear();
+		assert(cSOA.empty());
+		assert(cSOA.capacity() == 100);
+		cSOA.shrink_to_fit();
+		assert(cSOA.capacity() == 0);
+	}
+	{
+		std::cout << "a field constructor that throws destroys the fields of the record already built" << std::endl;
+		{
+			xstdtsl::safe_soa_vector<fragile_field,fragile_field> cSOA;
+			cSOA.reserve(16);
+			cSOA.push_back(fragile_field(1),fragile_field(2));
+			int iLive = fragile_field::g_iLive;
+			// the fields are copied into the parameters of nl_push_back, then the first field of the record is built and the second throws
+			assert(throws_with_budget(3,[&cSOA](){cSOA.push_back(fragile_field(3),fragile_field(4));}));
+			assert(fragile_field::g_iLive == iLive && cSOA.size() == 1);
+			// the second new record fails after its first field is built
+			assert(throws_with_budget(3,[&cSOA](){cSOA.resize(4);}));
+			assert(fragile_field::g_iLive == iLive && cSOA.size() == 1);
+			cSOA.push_back(fragile_field(5),fragile_field(6));
+			cSOA.push_back(fragile_field(7),fragile_field(8));
+			xstdtsl::safe_soa_vector<fragile_field,fragile_field> cAssigned;
+			iLive = fragile_field::g_iLive;
+			// the third record fails after its first field is copied; the first two records are kept
+			assert(throws_with_budget(5,[&cSOA,&cAssigned](){cAssigned = cSOA;}));
+			assert(fragile_field::g_iLive == iLive + 4 && cAssigned.size() == 2);
+			assert(throws_with_budget(5,[&cSOA](){xstdtsl::safe_soa_vector<fragile_field,fragile_field> cCopy(cSOA);}));
+			assert(fragile_field::g_iLive == iLive + 4);
+		}
+		assert(fragile_field::g_iLive == 0);
+	}
+	{
+		std::cout << "fields of non-trivial types" << std::endl;
+		xstdtsl::safe_soa_vector<std::string,int> cSOA;
+		for (int iI = 0; iI < 100; iI++)
+			cSOA.push_back(std::to_string(iI),iI);
+		assert(cSOA.load_field<0>(42) == "42");
+		assert(cSOA.find<0>(std::string("77")) == 77);
+		std::cout << "copy and assignment" << std::endl;
+		xstdtsl::safe_soa_vector<std::string,int> cCopy(cSOA);
+		assert(cCopy.size() == 100);
+		assert(cCopy.load(99) == std::make_tuple(std::string("99"),99));
+		cSOA.store_field<0>(0,std::string("changed"));
+		assert(cCopy.load_field<0>(0) == "0");
+		xstdtsl::safe_soa_vector<std::string,int> cAssigned;
+		cAssigned.push_back(std::string("x"),1);
+		cAssigned = cSOA;
+		assert(cAssigned.size() == 100);
+		assert(cAssigned.load_field<0>(0) == "changed");
+		cAssigned = cAssigned;
+		assert(cAssigned.size() == 100);
+		std::cout << "push_back of a field of the vector itself" << std::endl;
+		{
+			xstdtsl::safe_soa_vector<std::string,int>::write_control cWrite(cSOA);
+			for (int iI = 0; iI < 200; iI++)
+				cWrite.push_back(cWrite.field<0>()[iI],cWrite.field<1>()[iI]);
+		}
+		assert(cSOA.size() == 300);
+		assert(cSOA.load_field<0>(299) == "99");
+		assert(cSOA.load_field<0>(100) == "changed");
+		cSOA.resize(5);
+		assert(cSOA.load_field<0>(4) == "4");
+	}
+	{
+		std::cout << "concurrent appends and column scans" << std::endl;
+		xstdtsl::safe_soa_vector<int32_t,int64_t> cSOA;
+		std::thread cWriter([&cSOA]()
+		{
+			for (int32_t iI = 0; iI < 20000; iI++)
+				cSOA.push_back(iI,(int64_t)iI * 2);
+		});
+		for (int iJ = 0; iJ < 200; iJ++)
+		{
+			decltype(cSOA)::read_control cRead(cSOA);
+			xstdtsl::span<const int32_t> cKeys = cRead.field<0>();
+			xstdtsl::span<const int64_t> cValues = cRead.field<1>();
+			assert(cKeys.size() == cValues.size());
+			for (size_t nI = 0; nI < cKeys.size(); nI++)
+				assert(cValues[nI] == (int64_t)cKeys[nI] * 2 && cKeys[nI] == (int32_t)nI);
+		}
+		cWriter.join();
+		assert(cSOA.size() == 20000);
+		assert(cSOA.reduce_field<1>((int64_t)0) == (int64_t)19999 * 20000);
+	}
+	return 0;
+}
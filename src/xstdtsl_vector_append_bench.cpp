@@ -0,0 +1,52 @@
+#include <xstdtsl_safe_vector>
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <cstdint>
+#include <vector>
+
+///
+/// time the appending of a number of elements to an empty container
+/// \returns the elapsed time in seconds
+///
+template <class C> double time_append(C & io_cContainer, size_t i_nElements)
+{
+	auto tStart = std::chrono::steady_clock::now();
+	for (size_t nI = 0; nI < i_nElements; nI++)
+		io_cContainer.push_back((int64_t)nI);
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+}
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	size_t nMax_Elements = 100000000;
+	if (i_nNum_Params > 1)
+		nMax_Elements = std::strtoul(i_pParams[1],nullptr,10);
+
+	std::cout << "--------------=============== safe_vector append benchmark ===============--------------" << std::endl;
+	std::cout << "elements\tstd::vector Mappends/s\tsafe_vector Mappends/s\tsafe_vector (factor 1.5) Mappends/s" << std::endl;
+	for (size_t nElements = 1000; nElements <= nMax_Elements; nElements *= 10)
+	{
+		double dStd;
+		{
+			std::vector<int64_t> vStd;
+			dStd = time_append(vStd,nElements);
+		}
+		double dSafe;
+		{
+			xstdtsl::safe_vector<int64_t> cSafe;
+			dSafe = time_append(cSafe,nElements);
+			if (cSafe.size() != nElements)
+				std::cout << "size mismatch: " << cSafe.size() << std::endl;
+		}
+		double dSafe_15;
+		{
+			xstdtsl::safe_vector<int64_t> cSafe;
+			cSafe.set_growth_policy(1.5);
+			dSafe_15 = time_append(cSafe,nElements);
+		}
+		double dOps = (double)nElements * 1.0e-6;
+		std::cout << nElements << "\t" << dOps / dStd << "\t" << dOps / dSafe << "\t" << dOps / dSafe_15 << std::endl;
+	}
+	return 0;
+}
@@ -0,0 +1,55 @@
+#include <xstdtsl_safe_vector>
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <cstdint>
+
+///
+/// an 8 byte element with a user provided copy constructor, which defeats the bytewise copy and relocation paths
+///
+class nontrivial
+{
+public:
+	int64_t m_iValue; ///< the value held
+	nontrivial(void) noexcept : m_iValue(0) {}
+	nontrivial(int64_t i_iValue) noexcept : m_iValue(i_iValue) {}
+	nontrivial(const nontrivial & i_cRHO) noexcept : m_iValue(i_cRHO.m_iValue) {}
+	nontrivial & operator =(const nontrivial & i_cRHO) noexcept { m_iValue = i_cRHO.m_iValue; return *this; }
+};
+
+///
+/// time copy construction and reserve (reallocation) for a vector of the given number of elements
+///
+template <class T> void time_copy_reserve(size_t i_nElements, double & o_dCopy, double & o_dReserve)
+{
+	xstdtsl::safe_vector<T> cSource;
+	cSource.resize(i_nElements,T(1));
+
+	auto tStart = std::chrono::steady_clock::now();
+	xstdtsl::safe_vector<T> cCopy(cSource);
+	o_dCopy = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+
+	tStart = std::chrono::steady_clock::now();
+	cCopy.reserve(i_nElements * 2);
+	o_dReserve = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+}
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	size_t nMax_Bytes = 1024 * 1024 * 1024;
+	if (i_nNum_Params > 1)
+		nMax_Bytes = std::strtoul(i_pParams[1],nullptr,10);
+
+	std::cout << "--------------=============== safe_vector copy / reserve benchmark ===============--------------" << std::endl;
+	std::cout << "bytes\tcopy GB/s (per element)\tcopy GB/s (memcpy)\treserve GB/s (per element)\treserve GB/s (memcpy)" << std::endl;
+	for (size_t nBytes = 1024; nBytes <= nMax_Bytes; nBytes *= 8)
+	{
+		size_t nElements = nBytes / sizeof(int64_t);
+		double dCopy_Slow, dReserve_Slow, dCopy_Fast, dReserve_Fast;
+		time_copy_reserve<nontrivial>(nElements,dCopy_Slow,dReserve_Slow);
+		time_copy_reserve<int64_t>(nElements,dCopy_Fast,dReserve_Fast);
+		double dGB = (double)nBytes * 1.0e-9;
+		std::cout << nBytes << "\t" << dGB / dCopy_Slow << "\t" << dGB / dCopy_Fast << "\t" << dGB / dReserve_Slow << "\t" << dGB / dReserve_Fast << std::endl;
+	}
+	return 0;
+}
@@ -0,0 +1,101 @@
+#include <xstdtsl_safe_vector>
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+///
+/// time a function
+/// \returns the elapsed time in seconds
+///
+template <class F> double time_it(F i_fnFunction)
+{
+	auto tStart = std::chrono::steady_clock::now();
+	i_fnFunction();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+}
+
+///
+/// the approach the positional operations replace: copy the contents out, edit a std::vector and rebuild the safe_vector from it
+///
+template <class T, class F> void rebuild(xstdtsl::safe_vector<T> & io_cVector, F i_fnEdit)
+{
+	std::vector<T> vCopy(io_cVector.size());
+	vCopy.resize(io_cVector.load_range(0,vCopy.size(),vCopy.data()));
+	i_fnEdit(vCopy);
+	typename xstdtsl::safe_vector<T>::write_control cWrite(io_cVector);
+	cWrite.resize(0);
+	cWrite.append(static_cast<const T *>(vCopy.data()),vCopy.size());
+}
+
+///
+/// time each operation by the positional methods and by rebuilding, and print a table row
+///
+template <class T, class V> void compare(const char * i_pName, size_t i_nElements, size_t i_nOperations, V i_fnValue)
+{
+	xstdtsl::safe_vector<T> cSV;
+	for (size_t nI = 0; nI < i_nElements; nI++)
+		cSV.push_back(i_fnValue(nI));
+	xstdtsl::safe_vector<T> cRebuilt(cSV);
+	T tValue = i_fnValue(0);
+	double dInsert = time_it([&]()
+	{
+		for (size_t nI = 0; nI < i_nOperations; nI++)
+			cSV.insert(cSV.size() / 2,tValue);
+	});
+	double dInsert_Rebuild = time_it([&]()
+	{
+		for (size_t nI = 0; nI < i_nOperations; nI++)
+			rebuild(cRebuilt,[&tValue](std::vector<T> & io_vCopy) { io_vCopy.insert(io_vCopy.begin() + io_vCopy.size() / 2,tValue); });
+	});
+	double dErase = time_it([&]()
+	{
+		for (size_t nI = 0; nI < i_nOperations; nI++)
+			cSV.erase(cSV.size() / 2);
+	});
+	double dErase_Rebuild = time_it([&]()
+	{
+		for (size_t nI = 0; nI < i_nOperations; nI++)
+			rebuild(cRebuilt,[](std::vector<T> & io_vCopy) { io_vCopy.erase(io_vCopy.begin() + io_vCopy.size() / 2); });
+	});
+	// remove every third element; done once, so time the single pass against a single rebuild
+	size_t nRemoved = 0;
+	double dErase_If = time_it([&]()
+	{
+		size_t nCounter = 0;
+		nRemoved = cSV.erase_if([&nCounter](const T &) { return (nCounter++ % 3) == 0; });
+	});
+	double dErase_If_Rebuild = time_it([&]()
+	{
+		rebuild(cRebuilt,[](std::vector<T> & io_vCopy)
+		{
+			size_t nCounter = 0;
+			io_vCopy.erase(std::remove_if(io_vCopy.begin(),io_vCopy.end(),[&nCounter](const T &) { return (nCounter++ % 3) == 0; }),io_vCopy.end());
+		});
+	});
+	if (cSV.size() != cRebuilt.size() || nRemoved != (i_nElements + 2) / 3)
+		std::cout << "mismatch" << std::endl;
+	double dScale = 1.0e6 / (double)i_nOperations;
+	std::cout << i_pName << "\t" << i_nElements << "\t" << dInsert * dScale << "\t" << dInsert_Rebuild * dScale << "\t" << dErase * dScale << "\t" << dErase_Rebuild * dScale << "\t" << dErase_If * 1.0e6 << "\t" << dErase_If_Rebuild * 1.0e6 << std::endl;
+}
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	size_t nMax_Elements = 1024 * 1024;
+	size_t nOperations = 100;
+	if (i_nNum_Params > 1)
+		nMax_Elements = std::strtoul(i_pParams[1],nullptr,10);
+	if (i_nNum_Params > 2)
+		nOperations = std::strtoul(i_pParams[2],nullptr,10);
+
+	std::cout << "--------------=============== safe_vector insert and erase benchmark ===============--------------" << std::endl;
+	std::cout << "element\telements\tinsert us\tinsert rebuild us\terase us\terase rebuild us\terase_if us\terase_if rebuild us" << std::endl;
+	for (size_t nElements = 1024; nElements <= nMax_Elements; nElements *= 32)
+		compare<int64_t>("int64_t",nElements,nOperations,[](size_t i_nI) { return (int64_t)i_nI; });
+	for (size_t nElements = 1024; nElements <= nMax_Elements / 8; nElements *= 32)
+		compare<std::string>("32-char string",nElements,nOperations,[](size_t i_nI) { return std::string(32,(char)('a' + i_nI % 26)); });
+	return 0;
+}
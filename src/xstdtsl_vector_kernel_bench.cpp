@@ -0,0 +1,109 @@
+#include <xstdtsl_safe_vector>
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <cstdint>
+#include <algorithm>
+#include <numeric>
+
+///
+/// time repeated passes of a function
+/// \returns the mean time per element in nanoseconds
+///
+template <class F> double time_per_element(size_t i_nElements, size_t i_nPasses, F i_fnPass)
+{
+	auto tStart = std::chrono::steady_clock::now();
+	for (size_t nI = 0; nI < i_nPasses; nI++)
+		i_fnPass();
+	return std::chrono::duration<double,std::nano>(std::chrono::steady_clock::now() - tStart).count() / (double)(i_nElements * i_nPasses);
+}
+
+///
+/// time one operation through the read iterator, through a std algorithm over the raw view, and through the member kernels with the scalar and the best available instruction set, and print a table row
+///
+template <class T, class I, class S, class M> void compare(const char * i_pType, const char * i_pOperation, xstdtsl::safe_vector<T> & io_cVector, size_t i_nPasses, I i_fnIterator, S i_fnStd, M i_fnMember)
+{
+	size_t nElements = io_cVector.size();
+	volatile double dSink = 0.0;
+	double dIterator = time_per_element(nElements,i_nPasses,[&]()
+	{
+		typename xstdtsl::safe_vector<T>::read_iterator cIter(io_cVector,xstdtsl::safe_vector<T>::iterator_base::beginning);
+		dSink = dSink + (double)i_fnIterator(cIter);
+	});
+	double dStd = time_per_element(nElements,i_nPasses,[&]()
+	{
+		typename xstdtsl::safe_vector<T>::read_control cRead(io_cVector);
+		xstdtsl::span<const T> cView = cRead.view();
+		dSink = dSink + (double)i_fnStd(cView.begin(),cView.end());
+	});
+	xstdtsl_set_cpu_feature_mask(XSTDTSL_CPU_SCALAR);
+	double dScalar = time_per_element(nElements,i_nPasses,[&]() { dSink = dSink + (double)i_fnMember(io_cVector); });
+	xstdtsl_set_cpu_feature_mask(~0u);
+	double dVector = time_per_element(nElements,i_nPasses,[&]() { dSink = dSink + (double)i_fnMember(io_cVector); });
+	std::cout << i_pType << "\t" << i_pOperation << "\t" << nElements << "\t" << dIterator << "\t" << dStd << "\t" << dScalar << "\t" << dVector << std::endl;
+}
+
+///
+/// compare find, count, min and sum for one element type
+///
+template <class T> void compare_type(const char * i_pType, size_t i_nElements, size_t i_nPasses)
+{
+	typedef xstdtsl::safe_vector<T> vector_type;
+	vector_type cSV;
+	for (size_t nI = 0; nI < i_nElements; nI++)
+		cSV.push_back((T)((nI * 7919) % 1000));
+	const T tMissing = (T)-1;
+	const T tPresent = (T)500;
+	compare(i_pType,"find (absent)",cSV,i_nPasses,
+		[&](typename vector_type::read_iterator & io_cIter) { size_t nRet = 0; while (!io_cIter.is_at_end() && io_cIter.load() != tMissing) { io_cIter++; nRet++; } return nRet; },
+		[&](const T * i_pBegin, const T * i_pEnd) { return std::find(i_pBegin,i_pEnd,tMissing) - i_pBegin; },
+		[&](vector_type & i_cVector) { return i_cVector.find(tMissing); });
+	compare(i_pType,"count",cSV,i_nPasses,
+		[&](typename vector_type::read_iterator & io_cIter) { size_t nRet = 0; while (!io_cIter.is_at_end()) { if (io_cIter.load() == tPresent) nRet++; io_cIter++; } return nRet; },
+		[&](const T * i_pBegin, const T * i_pEnd) { return std::count(i_pBegin,i_pEnd,tPresent); },
+		[&](vector_type & i_cVector) { return i_cVector.count(tPresent); });
+	compare(i_pType,"find_min",cSV,i_nPasses,
+		[&](typename vector_type::read_iterator & io_cIter)
+		{
+			size_t nRet = 0;
+			size_t nIndex = 0;
+			T tMin = io_cIter.load();
+			while (!io_cIter.is_at_end())
+			{
+				T tValue = io_cIter.load();
+				if (tValue < tMin)
+				{
+					tMin = tValue;
+					nRet = nIndex;
+				}
+				io_cIter++;
+				nIndex++;
+			}
+			return nRet;
+		},
+		[&](const T * i_pBegin, const T * i_pEnd) { return std::min_element(i_pBegin,i_pEnd) - i_pBegin; },
+		[&](vector_type & i_cVector) { return i_cVector.find_min(); });
+	compare(i_pType,"sum",cSV,i_nPasses,
+		[&](typename vector_type::read_iterator & io_cIter) { typename vector_type::sum_type tRet = 0; while (!io_cIter.is_at_end()) { tRet += io_cIter.load(); io_cIter++; } return tRet; },
+		[&](const T * i_pBegin, const T * i_pEnd) { return std::accumulate(i_pBegin,i_pEnd,(typename vector_type::sum_type)0); },
+		[&](vector_type & i_cVector) { return i_cVector.sum(); });
+}
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	size_t nElements = 1024 * 1024;
+	size_t nPasses = 20;
+	if (i_nNum_Params > 1)
+		nElements = std::strtoul(i_pParams[1],nullptr,10);
+	if (i_nNum_Params > 2)
+		nPasses = std::strtoul(i_pParams[2],nullptr,10);
+
+	std::cout << "--------------=============== safe_vector search and reduction kernel benchmark ===============--------------" << std::endl;
+	std::cout << "detected cpu features: " << xstdtsl_get_detected_cpu_features() << std::endl;
+	std::cout << "type\toperation\telements\tread_iterator ns\tstd algorithm on view ns\tscalar kernel ns\tvector kernel ns" << std::endl;
+	compare_type<int32_t>("int32_t",nElements,nPasses);
+	compare_type<int64_t>("int64_t",nElements,nPasses);
+	compare_type<float>("float",nElements,nPasses);
+	compare_type<double>("double",nElements,nPasses);
+	return 0;
+}
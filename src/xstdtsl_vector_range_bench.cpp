@@ -0,0 +1,75 @@
+#include <xstdtsl_safe_vector>
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <cstdint>
+#include <vector>
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	size_t nElements = 10000;
+	size_t nRepetitions = 1000;
+	if (i_nNum_Params > 1)
+		nElements = std::strtoul(i_pParams[1],nullptr,10);
+	if (i_nNum_Params > 2)
+		nRepetitions = std::strtoul(i_pParams[2],nullptr,10);
+
+	std::vector<int64_t> vSource(nElements);
+	for (size_t nI = 0; nI < nElements; nI++)
+		vSource[nI] = (int64_t)nI;
+	std::vector<int64_t> vDest(nElements);
+
+	std::cout << "--------------=============== safe_vector range operation benchmark ===============--------------" << std::endl;
+	std::cout << "elements per operation: " << nElements << ", repetitions: " << nRepetitions << std::endl;
+
+	xstdtsl::safe_vector<int64_t> cVector;
+	auto tStart = std::chrono::steady_clock::now();
+	for (size_t nR = 0; nR < nRepetitions; nR++)
+	{
+		cVector.clear();
+		for (size_t nI = 0; nI < nElements; nI++)
+			cVector.push_back(vSource[nI]);
+	}
+	double dPush = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+
+	tStart = std::chrono::steady_clock::now();
+	for (size_t nR = 0; nR < nRepetitions; nR++)
+	{
+		cVector.clear();
+		cVector.append(vSource.data(),nElements);
+	}
+	double dAppend = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+
+	tStart = std::chrono::steady_clock::now();
+	for (size_t nR = 0; nR < nRepetitions; nR++)
+	{
+		for (size_t nI = 0; nI < nElements; nI++)
+			vDest[nI] = cVector.load(nI);
+	}
+	double dLoad = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+
+	tStart = std::chrono::steady_clock::now();
+	for (size_t nR = 0; nR < nRepetitions; nR++)
+		cVector.load_range(0,nElements,vDest.data());
+	double dLoad_Range = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+
+	tStart = std::chrono::steady_clock::now();
+	for (size_t nR = 0; nR < nRepetitions; nR++)
+	{
+		for (size_t nI = 0; nI < nElements; nI++)
+			cVector.store(nI,vSource[nI]);
+	}
+	double dStore = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+
+	tStart = std::chrono::steady_clock::now();
+	for (size_t nR = 0; nR < nRepetitions; nR++)
+		cVector.store_range(0,vSource.data(),nElements);
+	double dStore_Range = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+
+	double dOps = (double)nElements * (double)nRepetitions * 1.0e-6;
+	std::cout << "operation\tper element M/s\trange M/s\tspeedup" << std::endl;
+	std::cout << "append\t" << dOps / dPush << "\t" << dOps / dAppend << "\t" << dPush / dAppend << std::endl;
+	std::cout << "load\t" << dOps / dLoad << "\t" << dOps / dLoad_Range << "\t" << dLoad / dLoad_Range << std::endl;
+	std::cout << "store\t" << dOps / dStore << "\t" << dOps / dStore_Range << "\t" << dStore / dStore_Range << std::endl;
+	return 0;
+}
@@ -0,0 +1,87 @@
+#include <xstdtsl_safe_vector>
+#include <unistd.h>
+#include <fcntl.h>
+#include <iostream>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <string>
+
+///
+/// time a function
+/// \returns the elapsed time in seconds
+///
+template <class F> double time_it(F i_fnFunction)
+{
+	auto tStart = std::chrono::steady_clock::now();
+	i_fnFunction();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+}
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	std::string sPath = "/dev/shm/xstdtsl_vector_serialize_bench.tmp";
+	size_t nMax_Bytes = 512 * 1024 * 1024;
+	if (i_nNum_Params > 1)
+		sPath = i_pParams[1];
+	if (i_nNum_Params > 2)
+		nMax_Bytes = std::strtoul(i_pParams[2],nullptr,10);
+
+	std::cout << "--------------=============== safe_vector serialization benchmark ===============--------------" << std::endl;
+	std::cout << "file: " << sPath << std::endl;
+	std::cout << "bytes\tper-element fwrite GB/s\tserialize GB/s\tdeserialize GB/s\tstreamed chunks GB/s" << std::endl;
+	for (size_t nBytes = 1024 * 1024; nBytes <= nMax_Bytes; nBytes *= 8)
+	{
+		size_t nCount = nBytes / sizeof(int64_t);
+		xstdtsl::safe_vector<int64_t> cSV;
+		cSV.resize(nCount,1);
+		// the approach this replaces: iterate and write each element through a buffered stream
+		double dElement = time_it([&]()
+		{
+			FILE * pFile = std::fopen(sPath.c_str(),"wb");
+			xstdtsl::safe_vector<int64_t>::read_iterator cIter(cSV,xstdtsl::safe_vector<int64_t>::iterator_base::beginning);
+			while (!cIter.is_at_end())
+			{
+				int64_t iValue = cIter.load();
+				std::fwrite(&iValue,sizeof(iValue),1,pFile);
+				cIter++;
+			}
+			std::fclose(pFile);
+		});
+		double dSerialize = time_it([&]()
+		{
+			int iFile = open(sPath.c_str(),O_CREAT | O_TRUNC | O_WRONLY,0644);
+			cSV.serialize(iFile);
+			close(iFile);
+		});
+		xstdtsl::safe_vector<int64_t> cRead;
+		double dDeserialize = time_it([&]()
+		{
+			int iFile = open(sPath.c_str(),O_RDONLY);
+			cRead.deserialize(iFile);
+			close(iFile);
+		});
+		// a producer appending sixteenths of the data and writing each as a chunk; includes the cost of the appends
+		double dStreamed = time_it([&]()
+		{
+			int iFile = open(sPath.c_str(),O_CREAT | O_TRUNC | O_WRONLY,0644);
+			xstdtsl::safe_vector<int64_t> cProducer;
+			cProducer.reserve(nCount);
+			size_t nPosition = 0;
+			xstdtsl::safe_vector<int64_t>::write_stream_header(iFile);
+			xstdtsl::safe_vector<int64_t>::read_control cSource(cSV);
+			for (size_t nChunk = 0; nChunk < 16; nChunk++)
+			{
+				xstdtsl::span<const int64_t> cPart = cSource.view().subspan(nChunk * (nCount / 16),nCount / 16);
+				cProducer.append(cPart.data(),cPart.size());
+				nPosition = cProducer.write_chunk(iFile,nPosition);
+			}
+			xstdtsl::safe_vector<int64_t>::write_stream_end(iFile);
+			close(iFile);
+		});
+		std::cout << nBytes << "\t" << (double)nBytes / dElement * 1.0e-9 << "\t" << (double)nBytes / dSerialize * 1.0e-9 << "\t" << (double)nBytes / dDeserialize * 1.0e-9 << "\t" << (double)nBytes / dStreamed * 1.0e-9 << std::endl;
+	}
+	std::remove(sPath.c_str());
+	return 0;
+}
@@ -0,0 +1,220 @@
+#include <xstdtsl_safe_vector>
+#include <unistd.h>
+#include <fcntl.h>
+#include <thread>
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <cstdint>
+#include <string>
+#include <stdexcept>
+
+///
+/// append a string to a stream buffer
+///
+static void encode_string(const std::string & i_sValue, std::string & io_sBuffer)
+{
+	io_sBuffer += i_sValue;
+}
+///
+/// recover a string from its encoding
+/// \returns the string
+///
+static std::string decode_string(const char * i_pData, size_t i_nBytes)
+{
+	return std::string(i_pData,i_nBytes);
+}
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	std::string sPath = "xstdtsl_vector_serialize_test.tmp";
+	std::cout << "--------------=============== safe_vector serialization tests ===============--------------" << std::endl;
+	{
+		std::cout << "serialize to a file and deserialize" << std::endl;
+		xstdtsl::safe_vector<int64_t> cSV;
+		for (int64_t iI = 0; iI < 100000; iI++)
+			cSV.push_back(iI * 3);
+		int iFile = open(sPath.c_str(),O_CREAT | O_TRUNC | O_RDWR,0644);
+		assert(iFile >= 0);
+		cSV.serialize(iFile);
+		assert(lseek(iFile,0,SEEK_END) == (off_t)(sizeof(xstdtsl::stream_header) + 100000 * sizeof(int64_t)));
+		lseek(iFile,0,SEEK_SET);
+		xstdtsl::safe_vector<int64_t> cRead;
+		cRead.push_back(-1);
+		cRead.deserialize(iFile);
+		assert(cRead.size() == 100000);
+		for (int64_t iI = 0; iI < 100000; iI++)
+			assert(cRead.load(iI) == iI * 3);
+		std::cout << "confirm a stream of another element type is rejected" << std::endl;
+		lseek(iFile,0,SEEK_SET);
+		xstdtsl::safe_vector<int32_t> cOther;
+		bool bThrown = false;
+		try
+		{
+			cOther.deserialize(iFile);
+		}
+		catch (const std::runtime_error &)
+		{
+			bThrown = true;
+		}
+		assert(bThrown && cOther.empty());
+		std::cout << "confirm a truncated stream is reported" << std::endl;
+		assert(ftruncate(iFile,sizeof(xstdtsl::stream_header) + 1000) == 0);
+		lseek(iFile,0,SEEK_SET);
+		bThrown = false;
+		try
+		{
+			cRead.deserialize(iFile);
+		}
+		catch (const std::runtime_error &)
+		{
+			bThrown = true;
+		}
+		assert(bThrown && cRead.size() == 100000 && cRead.load(99999) == 99999 * 3);
+		std::cout << "confirm a corrupt count fails at the end of the stream without allocating for it" << std::endl;
+		xstdtsl::stream_header cCorrupt = xstdtsl::make_stream_header(sizeof(int64_t),0,(UINT64_MAX / sizeof(int64_t)) - 1);
+		assert(ftruncate(iFile,0) == 0);
+		assert(pwrite(iFile,&cCorrupt,sizeof(cCorrupt),0) == (ssize_t)sizeof(cCorrupt));
+		lseek(iFile,0,SEEK_SET);
+		bThrown = false;
+		try
+		{
+			cRead.deserialize(iFile);
+		}
+		catch (const std::runtime_error &)
+		{
+			bThrown = true;
+		}
+		assert(bThrown && cRead.size() == 100000);
+		std::cout << "round trip of an empty vector" << std::endl;
+		xstdtsl::safe_vector<int64_t> cEmpty;
+		assert(ftruncate(iFile,0) == 0);
+		lseek(iFile,0,SEEK_SET);
+		cEmpty.serialize(iFile);
+		lseek(iFile,0,SEEK_SET);
+		cSV.deserialize(iFile);
+		assert(cSV.empty());
+		close(iFile);
+	}
+	{
+		std::cout << "serialize with an encoder and deserialize with a decoder" << std::endl;
+		xstdtsl::safe_vector<std::string> cSV;
+		for (int iI = 0; iI < 1000; iI++)
+			cSV.push_back(std::string((size_t)(iI % 50),(char)('a' + iI % 26)));
+		int iFile = open(sPath.c_str(),O_CREAT | O_TRUNC | O_RDWR,0644);
+		assert(iFile >= 0);
+		cSV.serialize(iFile,encode_string);
+		lseek(iFile,0,SEEK_SET);
+		xstdtsl::safe_vector<std::string> cRead;
+		cRead.deserialize(iFile,decode_string);
+		assert(cRead.size() == 1000);
+		for (int iI = 0; iI < 1000; iI++)
+			assert(cRead.load(iI) == cSV.load(iI));
+		std::cout << "confirm an encoded stream is not read as raw elements" << std::endl;
+		lseek(iFile,0,SEEK_SET);
+		xstdtsl::safe_vector<int64_t> cRaw;
+		bool bThrown = false;
+		try
+		{
+			cRaw.deserialize(iFile);
+		}
+		catch (const std::runtime_error &)
+		{
+			bThrown = true;
+		}
+		assert(bThrown);
+		std::cout << "confirm a corrupt element length fails at the end of the stream without allocating for it" << std::endl;
+		xstdtsl::stream_header cHeader = xstdtsl::make_stream_header(0,xstdtsl::g_uStream_Encoded,1);
+		uint64_t uLength = UINT64_MAX / 2;
+		assert(ftruncate(iFile,0) == 0);
+		assert(pwrite(iFile,&cHeader,sizeof(cHeader),0) == (ssize_t)sizeof(cHeader));
+		assert(pwrite(iFile,&uLength,sizeof(uLength),sizeof(cHeader)) == (ssize_t)sizeof(uLength));
+		lseek(iFile,0,SEEK_SET);
+		bThrown = false;
+		try
+		{
+			cRead.deserialize(iFile,decode_string);
+		}
+		catch (const std::runtime_error &)
+		{
+			bThrown = true;
+		}
+		assert(bThrown && cRead.size() == 1000);
+		close(iFile);
+	}
+	{
+		std::cout << "stream chunks through a pipe while the producer appends" << std::endl;
+		int iPipe[2];
+		assert(pipe(iPipe) == 0);
+		xstdtsl::safe_vector<int64_t> cProduced;
+		std::thread cProducer([&cProduced,&iPipe]()
+		{
+			xstdtsl::safe_vector<int64_t>::write_stream_header(iPipe[1]);
+			size_t nPosition = 0;
+			for (int64_t iBatch = 0; iBatch < 100; iBatch++)
+			{
+				for (int64_t iI = 0; iI < 5000; iI++)
+					cProduced.push_back(iBatch * 5000 + iI);
+				nPosition = cProduced.write_chunk(iPipe[1],nPosition);
+				assert(nPosition == cProduced.size());
+			}
+			assert(cProduced.write_chunk(iPipe[1],nPosition) == nPosition);
+			xstdtsl::safe_vector<int64_t>::write_stream_end(iPipe[1]);
+			close(iPipe[1]);
+		});
+		xstdtsl::safe_vector<int64_t> cConsumed;
+		cConsumed.deserialize(iPipe[0]);
+		cProducer.join();
+		close(iPipe[0]);
+		assert(cConsumed.size() == 500000);
+		for (int64_t iI = 0; iI < 500000; iI += 997)
+			assert(cConsumed.load(iI) == iI);
+		assert(cConsumed.load(499999) == 499999);
+	}
+	{
+		std::cout << "stream encoded chunks through a pipe" << std::endl;
+		int iPipe[2];
+		assert(pipe(iPipe) == 0);
+		xstdtsl::safe_vector<std::string> cProduced;
+		std::thread cProducer([&cProduced,&iPipe]()
+		{
+			xstdtsl::safe_vector<std::string>::write_stream_header(iPipe[1],true);
+			size_t nPosition = 0;
+			for (int iI = 0; iI < 3000; iI++)
+			{
+				cProduced.push_back(std::to_string(iI));
+				if (iI % 100 == 99)
+					nPosition = cProduced.write_chunk(iPipe[1],nPosition,encode_string);
+			}
+			xstdtsl::safe_vector<std::string>::write_stream_end(iPipe[1]);
+			close(iPipe[1]);
+		});
+		xstdtsl::safe_vector<std::string> cConsumed;
+		cConsumed.deserialize(iPipe[0],decode_string);
+		cProducer.join();
+		close(iPipe[0]);
+		assert(cConsumed.size() == 3000);
+		assert(cConsumed.load(0) == "0" && cConsumed.load(2999) == "2999");
+	}
+	{
+		std::cout << "serialize a large vector through a pipe" << std::endl;
+		int iPipe[2];
+		assert(pipe(iPipe) == 0);
+		xstdtsl::safe_vector<int64_t> cSV;
+		cSV.resize(2000000);
+		cSV.store(1999999,7);
+		std::thread cWriter([&cSV,&iPipe]()
+		{
+			cSV.serialize(iPipe[1]);
+			close(iPipe[1]);
+		});
+		xstdtsl::safe_vector<int64_t> cRead;
+		cRead.deserialize(iPipe[0]);
+		cWriter.join();
+		close(iPipe[0]);
+		assert(cRead.size() == 2000000);
+		assert(cRead.load(1999999) == 7 && cRead.load(0) == 0);
+	}
+	std::remove(sPath.c_str());
+	return 0;
+}
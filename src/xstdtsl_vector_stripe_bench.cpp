@@ -0,0 +1,76 @@
+#include <xstdtsl_safe_vector>
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+#include <cstdint>
+
+///
+/// run update threads against a vector
+/// \returns the total number of updates per second
+///
+static double update_rate(
+	xstdtsl::safe_vector<uint64_t> & io_cVector, ///< the vector to update
+	size_t i_nThreads, ///< the number of updating threads
+	size_t i_nUpdates, ///< the number of updates made by each thread
+	bool i_bDisjoint ///< each thread updates its own region of the vector; otherwise all threads update random elements of the whole vector
+	)
+{
+	size_t nElements = io_cVector.size();
+	std::vector<std::thread> vThreads;
+	auto tStart = std::chrono::steady_clock::now();
+	for (size_t nT = 0; nT < i_nThreads; nT++)
+	{
+		vThreads.emplace_back([&io_cVector,nT,nElements,i_nThreads,i_nUpdates,i_bDisjoint]()
+		{
+			size_t nRegion = i_bDisjoint ? nElements / i_nThreads : nElements;
+			size_t nBase = i_bDisjoint ? nRegion * nT : 0;
+			uint64_t uState = 88172645463325252ULL + nT;
+			for (size_t nI = 0; nI < i_nUpdates; nI++)
+			{
+				uState ^= uState << 13;
+				uState ^= uState >> 7;
+				uState ^= uState << 17;
+				io_cVector.store(nBase + (size_t)(uState % nRegion),uState);
+			}
+		});
+	}
+	for (auto & cThread : vThreads)
+		cThread.join();
+	double dSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+	return (double)(i_nThreads * i_nUpdates) / dSeconds;
+}
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	size_t nMax_Threads = 16;
+	size_t nElements = 1 << 22;
+	size_t nUpdates = 1000000;
+	if (i_nNum_Params > 1)
+		nMax_Threads = std::strtoul(i_pParams[1],nullptr,10);
+	if (i_nNum_Params > 2)
+		nElements = std::strtoul(i_pParams[2],nullptr,10);
+	if (i_nNum_Params > 3)
+		nUpdates = std::strtoul(i_pParams[3],nullptr,10);
+	const size_t lpnStripes[] = {0, 16, 256};
+
+	std::cout << "--------------=============== striped store benchmark ===============--------------" << std::endl;
+	std::cout << "elements: " << nElements << " updates per thread: " << nUpdates << std::endl;
+	std::cout << "threads\tpattern\tstripes\tupdates per second" << std::endl;
+	xstdtsl::safe_vector<uint64_t> cVector;
+	cVector.resize(nElements,0);
+	for (size_t nThreads = 1; nThreads <= nMax_Threads; nThreads *= 2)
+	{
+		for (bool bDisjoint : {true, false})
+		{
+			for (size_t nStripes : lpnStripes)
+			{
+				cVector.set_lock_stripes(nStripes);
+				double dRate = update_rate(cVector,nThreads,nUpdates,bDisjoint);
+				std::cout << nThreads << "\t" << (bDisjoint ? "disjoint" : "overlapping") << "\t" << nStripes << "\t" << dRate << std::endl;
+			}
+		}
+	}
+	return 0;
+}
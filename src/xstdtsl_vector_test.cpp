@@ -4,9 +4,101 @@
 #include <iostream>
 #include <chrono>
 #include <cassert>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <stdexcept>
+#include <sstream>
+#include <iterator>
+#include <memory_resource>
 
 #include <xstdtsl_vector_test.hpp>
 
+///
+/// element type that counts copy and move operations
+///
+class counted
+{
+public:
+	static size_t g_nCopies; ///< number of copy constructions and assignments
+	static size_t g_nMoves; ///< number of move constructions and assignments
+	int m_iValue; ///< the value held
+
+	counted(void) noexcept : m_iValue(0) {}
+	explicit counted(int i_iValue) noexcept : m_iValue(i_iValue) {}
+	counted(int i_iA, int i_iB) noexcept : m_iValue(i_iA + i_iB) {}
+	counted(const counted & i_cRHO) noexcept : m_iValue(i_cRHO.m_iValue) { g_nCopies++; }
+	counted(counted && i_cRHO) noexcept : m_iValue(i_cRHO.m_iValue) { g_nMoves++; }
+	counted & operator =(const counted & i_cRHO) noexcept { m_iValue = i_cRHO.m_iValue; g_nCopies++; return *this; }
+	counted & operator =(counted && i_cRHO) noexcept { m_iValue = i_cRHO.m_iValue; g_nMoves++; return *this; }
+};
+size_t counted::g_nCopies = 0;
+size_t counted::g_nMoves = 0;
+
+///
+/// element type that is not trivially copyable but opts in to bytewise relocation
+///
+class relocatable : public counted
+{
+public:
+	relocatable(void) noexcept {}
+	explicit relocatable(int i_iValue) noexcept : counted(i_iValue) {}
+};
+namespace xstdtsl
+{
+	template <> struct is_trivially_relocatable<relocatable> : std::true_type
+	{
+	};
+}
+
+
+///
+/// element type that tracks live instances and whose copy constructor throws for a flagged value
+///
+class copy_throws
+{
+public:
+	static int g_iLive; ///< number of instances alive
+	int m_iValue; ///< the value held; copying -1 throws
+
+	copy_throws(void) noexcept : m_iValue(0) { g_iLive++; }
+	explicit copy_throws(int i_iValue) noexcept : m_iValue(i_iValue) { g_iLive++; }
+	copy_throws(const copy_throws & i_cRHO) noexcept(false) : m_iValue(i_cRHO.m_iValue)
+	{
+		if (m_iValue == -1)
+			throw std::runtime_error("copy");
+		g_iLive++;
+	}
+	copy_throws & operator =(const copy_throws & i_cRHO) noexcept { m_iValue = i_cRHO.m_iValue; return *this; }
+	~copy_throws(void) noexcept { g_iLive--; }
+};
+int copy_throws::g_iLive = 0;
+
+
+///
+/// an over-aligned type occupying one cache line
+///
+struct alignas(64) cache_line
+{
+	int64_t	m_lliValues[8];
+};
+
+///
+/// get the address of the first element of a vector; the vector must not be empty
+/// \returns the address of element 0
+///
+template <class V> uintptr_t first_element_address(const V & i_cVector)
+{
+	uintptr_t uRet = 0;
+	size_t nOld_Threads = xstdtsl_get_parallel_threads();
+	xstdtsl_set_parallel_threads(1); // elements are then visited in order on the calling thread
+	i_cVector.parallel_for_each([&uRet](const auto & i_tValue) { if (uRet == 0) uRet = reinterpret_cast<uintptr_t>(&i_tValue); });
+	xstdtsl_set_parallel_threads(nOld_Threads);
+	return uRet;
+}
 
 int main(int i_nNum_Params, char * i_pParams[])
 {
@@ -256,7 +348,1028 @@ int main(int i_nNum_Params, char * i_pParams[])
 		std::cout << "confirm correct size" << std::endl;
 		assert(cVect.size() == 0);
 	}
+	std::cout << "--------------=============== max_size tests ===============--------------" << std::endl;
+	{
+		std::cout << "confirm max_size is nonzero" << std::endl;
+		assert(cSFI.max_size() > 0);
+		std::cout << "confirm cached available memory is repeatable within the refresh interval" << std::endl;
+		xstdtsl_set_available_memory_refresh_interval(60000000);
+		size_t nCached = xstdtsl_get_available_memory_cached();
+		assert(nCached > 0);
+		assert(xstdtsl_get_available_memory_cached() == nCached);
+		std::cout << "confirm cgroup aware memory exceeds neither host memory nor the container limit" << std::endl;
+		xstdtsl_set_available_memory_cgroup_aware(true);
+		assert(xstdtsl_get_available_memory_cached() > 0);
+		// host memory may change between samples, so the cgroup aware value is bracketed by samples taken before and after it, with some slack
+		size_t nHost_Before = xstdtsl_get_available_memory();
+		size_t nCgroup = xstdtsl_get_available_memory_cgroup();
+		size_t nHost_After = xstdtsl_get_available_memory();
+		size_t nSlack = (size_t)64 << 20;
+		assert(nCgroup <= std::max(nHost_Before,nHost_After) + nSlack);
+		size_t nLimit = xstdtsl_get_container_memory_limit();
+		assert(nLimit == 0 || nCgroup <= nLimit);
+		xstdtsl_set_available_memory_cgroup_aware(false);
+		std::cout << "start and stop the background memory monitor" << std::endl;
+		xstdtsl_set_available_memory_refresh_interval(1000);
+		assert(xstdtsl_start_available_memory_monitor());
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+		assert(cSFI.max_size() > 0);
+		xstdtsl_stop_available_memory_monitor();
+		xstdtsl_set_available_memory_refresh_interval(100000);
+	}
+	std::cout << "--------------=============== find tests ===============--------------" << std::endl;
+	{
+		xstdtsl::safe_vector<int> cSFIf;
+		xstdtsl::safe_vector<int64_t> cSFLf;
+		for (int iI = 0; iI < 100; iI++)
+		{
+			cSFIf.push_back(iI);
+			cSFLf.push_back((int64_t)iI << 33);
+		}
+		unsigned int uFeature_Levels[] = {XSTDTSL_CPU_SCALAR, XSTDTSL_CPU_SSE42, XSTDTSL_CPU_AVX2, XSTDTSL_CPU_AVX512};
+		unsigned int uDetected = xstdtsl_get_detected_cpu_features();
+		for (unsigned int uLevel : uFeature_Levels)
+		{
+			if (uLevel != XSTDTSL_CPU_SCALAR && (uDetected & uLevel) == 0)
+				continue;
+			std::cout << "force kernel level " << uLevel << std::endl;
+			xstdtsl_set_cpu_feature_mask(uLevel);
+			assert(xstdtsl_get_kernel_table()->uFeature_Level == uLevel);
+			std::cout << "confirm find locates each element" << std::endl;
+			for (int iI = 0; iI < 100; iI++)
+			{
+				assert(cSFIf.find(iI) == (size_t)iI);
+				assert(cSFLf.find((int64_t)iI << 33) == (size_t)iI);
+			}
+			std::cout << "confirm find honors start index and reports missing values" << std::endl;
+			assert(cSFIf.find(5,6) == cSFIf.size());
+			assert(cSFIf.find(97,90) == 97);
+			assert(cSFIf.find(-1) == cSFIf.size());
+			assert(cSFLf.find(1) == cSFLf.size());
+		}
+		xstdtsl_set_cpu_feature_mask(~0u);
+		std::cout << "confirm find for non-integral type" << std::endl;
+		xstdtsl::safe_vector<double> cSFDf;
+		cSFDf.push_back(1.5);
+		cSFDf.push_back(2.5);
+		assert(cSFDf.find(2.5) == 1);
+		assert(cSFDf.find(3.5) == 2);
+	}
+	std::cout << "--------------=============== search and reduction kernel tests ===============--------------" << std::endl;
+	{
+		unsigned int uFeature_Levels[] = {XSTDTSL_CPU_SCALAR, XSTDTSL_CPU_SSE42, XSTDTSL_CPU_AVX2, XSTDTSL_CPU_AVX512};
+		unsigned int uDetected = xstdtsl_get_detected_cpu_features();
+		size_t nSizes[] = {1, 7, 37, 1000};
+		for (unsigned int uLevel : uFeature_Levels)
+		{
+			if (uLevel != XSTDTSL_CPU_SCALAR && (uDetected & uLevel) == 0)
+				continue;
+			std::cout << "force kernel level " << uLevel << std::endl;
+			xstdtsl_set_cpu_feature_mask(uLevel);
+			for (size_t nSize : nSizes)
+			{
+				std::cout << "confirm count, min, max and sum of " << nSize << " elements against std algorithms" << std::endl;
+				std::vector<int32_t> vI32;
+				std::vector<int64_t> vI64;
+				std::vector<float> vF32;
+				std::vector<double> vF64;
+				for (size_t nI = 0; nI < nSize; nI++)
+				{
+					// a pseudo-random pattern with repeats, negative values and the extremes far from the start
+					int64_t iValue = (int64_t)((nI * 7919) % 101) - 50;
+					vI32.push_back((int32_t)iValue * 40000000);
+					vI64.push_back(iValue * ((int64_t)1 << 40));
+					vF32.push_back((float)iValue * 0.25f);
+					vF64.push_back((double)iValue * 0.125);
+				}
+				xstdtsl::safe_vector<int32_t> cSVI32;
+				xstdtsl::safe_vector<int64_t> cSVI64;
+				xstdtsl::safe_vector<float> cSVF32;
+				xstdtsl::safe_vector<double> cSVF64;
+				cSVI32.append(vI32.begin(),vI32.end());
+				cSVI64.append(vI64.begin(),vI64.end());
+				cSVF32.append(vF32.begin(),vF32.end());
+				cSVF64.append(vF64.begin(),vF64.end());
+				assert(cSVI32.count(vI32[0]) == (size_t)std::count(vI32.begin(),vI32.end(),vI32[0]));
+				assert(cSVI64.count(vI64[nSize - 1]) == (size_t)std::count(vI64.begin(),vI64.end(),vI64[nSize - 1]));
+				assert(cSVF32.count(vF32[0]) == (size_t)std::count(vF32.begin(),vF32.end(),vF32[0]));
+				assert(cSVF64.count(vF64[0]) == (size_t)std::count(vF64.begin(),vF64.end(),vF64[0]));
+				assert(cSVI32.count(7) == 0);
+				assert(cSVI32.find_min() == (size_t)(std::min_element(vI32.begin(),vI32.end()) - vI32.begin()));
+				assert(cSVI32.find_max() == (size_t)(std::max_element(vI32.begin(),vI32.end()) - vI32.begin()));
+				assert(cSVI64.find_min() == (size_t)(std::min_element(vI64.begin(),vI64.end()) - vI64.begin()));
+				assert(cSVI64.find_max() == (size_t)(std::max_element(vI64.begin(),vI64.end()) - vI64.begin()));
+				assert(cSVF32.find_min() == (size_t)(std::min_element(vF32.begin(),vF32.end()) - vF32.begin()));
+				assert(cSVF64.find_max() == (size_t)(std::max_element(vF64.begin(),vF64.end()) - vF64.begin()));
+				int64_t iMin = 0;
+				int64_t iMax = 0;
+				assert(cSVI64.minmax(iMin,iMax));
+				assert(iMin == *std::min_element(vI64.begin(),vI64.end()) && iMax == *std::max_element(vI64.begin(),vI64.end()));
+				// the int32 values overflow a 32-bit sum; the values are multiples of 1/8 so the floating point sums are exact
+				assert(cSVI32.sum() == std::accumulate(vI32.begin(),vI32.end(),(int64_t)0));
+				assert(cSVI64.sum() == std::accumulate(vI64.begin(),vI64.end(),(int64_t)0));
+				assert(cSVF32.sum() == std::accumulate(vF32.begin(),vF32.end(),0.0));
+				assert(cSVF64.sum() == std::accumulate(vF64.begin(),vF64.end(),0.0));
+			}
+			std::cout << "confirm floating point comparisons and NaN handling" << std::endl;
+			xstdtsl::safe_vector<double> cSVNaN;
+			for (int iI = 0; iI < 20; iI++)
+				cSVNaN.push_back(std::numeric_limits<double>::quiet_NaN());
+			double dMin = 0.0;
+			double dMax = 0.0;
+			assert(!cSVNaN.minmax(dMin,dMax));
+			assert(cSVNaN.find_min() == cSVNaN.size());
+			assert(cSVNaN.count(std::numeric_limits<double>::quiet_NaN()) == 0);
+			cSVNaN.store(13,-0.0);
+			cSVNaN.store(17,3.0);
+			assert(cSVNaN.minmax(dMin,dMax) && dMin == 0.0 && dMax == 3.0);
+			assert(cSVNaN.find_min() == 13 && cSVNaN.find_max() == 17);
+			assert(cSVNaN.find(0.0) == 13);
+			xstdtsl::safe_vector<float> cSVFloat;
+			for (int iI = 0; iI < 40; iI++)
+				cSVFloat.push_back(iI == 33 ? std::numeric_limits<float>::quiet_NaN() : (float)iI);
+			assert(cSVFloat.find(35.0f) == 35 && cSVFloat.find(-1.0f) == 40);
+			assert(cSVFloat.count(std::numeric_limits<float>::quiet_NaN()) == 0);
+			assert(cSVFloat.find_max() == 39);
+		}
+		xstdtsl_set_cpu_feature_mask(~0u);
+		std::cout << "confirm the algorithms on an empty vector and on types without kernels" << std::endl;
+		xstdtsl::safe_vector<int32_t> cSVEmpty;
+		int32_t iMin = 5;
+		int32_t iMax = 5;
+		assert(!cSVEmpty.minmax(iMin,iMax) && iMin == 5);
+		assert(cSVEmpty.find_min() == 0 && cSVEmpty.count(0) == 0 && cSVEmpty.sum() == 0);
+		xstdtsl::safe_vector<long long> cSVLong;
+		for (long long llValue : {7LL,-3LL,12LL,5LL})
+			cSVLong.push_back(llValue);
+		long long llMin = 0;
+		long long llMax = 0;
+		assert(cSVLong.minmax(llMin,llMax) && llMin == -3 && llMax == 12);
+		xstdtsl::safe_vector<uint16_t> cSVShort;
+		uint64_t uShort_Sum = 0;
+		for (int iI = 0; iI < 1000; iI++)
+		{
+			cSVShort.push_back((uint16_t)(iI * 100));
+			uShort_Sum += (uint16_t)(iI * 100);
+		}
+		assert(cSVShort.sum() == uShort_Sum);
+		assert(cSVShort.find_max() == 655);
+		xstdtsl::safe_vector<std::string> cSVWords;
+		cSVWords.push_back("pear");
+		cSVWords.push_back("apple");
+		cSVWords.push_back("zucchini");
+		cSVWords.push_back("apple");
+		assert(cSVWords.count("apple") == 2);
+		assert(cSVWords.find_min() == 1 && cSVWords.find_max() == 2);
+		{
+			xstdtsl::safe_vector<std::string>::read_control cRead(cSVWords);
+			std::string sMin;
+			std::string sMax;
+			assert(cRead.minmax(sMin,sMax) && sMin == "apple" && sMax == "zucchini");
+			assert(cRead.count("pear") == 1);
+		}
+	}
+	std::cout << "--------------=============== numa placement tests ===============--------------" << std::endl;
+	{
+		std::cout << "confirm at least one numa node" << std::endl;
+		assert(xstdtsl_get_numa_node_count() >= 1);
+		std::cout << "construct vector with interleaved placement" << std::endl;
+		xstdtsl::safe_vector<int> cSFIn(XSTDTSL_NUMA_INTERLEAVE);
+		assert(cSFIn.get_numa_policy() == XSTDTSL_NUMA_INTERLEAVE);
+		for (int iI = 0; iI < 10000; iI++)
+			cSFIn.push_back(iI);
+		std::cout << "confirm contents" << std::endl;
+		for (int iI = 0; iI < 10000; iI++)
+			assert(cSFIn.load(iI) == iI);
+		std::cout << "change placement to bound to node 0" << std::endl;
+		cSFIn.set_numa_policy(XSTDTSL_NUMA_BIND,0);
+		assert(cSFIn.get_numa_policy() == XSTDTSL_NUMA_BIND);
+		assert(cSFIn.size() == 10000);
+		for (int iI = 0; iI < 10000; iI++)
+			assert(cSFIn.load(iI) == iI);
+		std::cout << "change placement to local" << std::endl;
+		cSFIn.set_numa_policy(XSTDTSL_NUMA_LOCAL);
+		cSFIn.shrink_to_fit();
+		for (int iI = 0; iI < 10000; iI++)
+			assert(cSFIn.load(iI) == iI);
+		std::cout << "change placement to default" << std::endl;
+		cSFIn.set_numa_policy(XSTDTSL_NUMA_DEFAULT);
+		for (int iI = 0; iI < 10000; iI++)
+			assert(cSFIn.load(iI) == iI);
+		std::cout << "set and reset thread placement policy" << std::endl;
+		xstdtsl_numa_set_thread_policy(XSTDTSL_NUMA_LOCAL,0);
+		xstdtsl_numa_set_thread_policy(XSTDTSL_NUMA_DEFAULT,0);
+	}
+	std::cout << "--------------=============== growth policy tests ===============--------------" << std::endl;
+	{
+		xstdtsl::safe_vector<int> cSFGrow;
+		std::cout << "confirm default growth policy" << std::endl;
+		assert(cSFGrow.get_growth_factor() == 2.0);
+		assert(cSFGrow.get_growth_minimum() == 16);
+		assert(cSFGrow.get_growth_maximum_step() == 0);
+		std::cout << "confirm first push_back allocates the minimum" << std::endl;
+		cSFGrow.push_back(0);
+		assert(cSFGrow.capacity() >= 16);
+		std::cout << "confirm capacity grows geometrically" << std::endl;
+		size_t nReallocations = 0;
+		size_t nCapacity = cSFGrow.capacity();
+		for (int iI = 1; iI < 100000; iI++)
+		{
+			cSFGrow.push_back(iI);
+			if (cSFGrow.capacity() != nCapacity)
+			{
+				assert(cSFGrow.capacity() >= 2 * nCapacity);
+				nCapacity = cSFGrow.capacity();
+				nReallocations++;
+			}
+		}
+		assert(nReallocations < 20);
+		for (int iI = 0; iI < 100000; iI++)
+			assert(cSFGrow.load(iI) == iI);
+		std::cout << "confirm maximum step limits growth" << std::endl;
+		xstdtsl::safe_vector<int> cSFStep;
+		cSFStep.set_growth_policy(2.0,4,1000);
+		assert(cSFStep.get_growth_maximum_step() == 1000);
+		nCapacity = 0;
+		for (int iI = 0; iI < 10000; iI++)
+		{
+			cSFStep.push_back(iI);
+			if (cSFStep.capacity() != nCapacity)
+			{
+				assert(cSFStep.capacity() - nCapacity <= 1000 + 8);
+				nCapacity = cSFStep.capacity();
+			}
+		}
+		std::cout << "confirm a factor of 1 grows to the required size" << std::endl;
+		xstdtsl::safe_vector<int> cSFExact;
+		cSFExact.set_growth_policy(1.0,0);
+		for (int iI = 0; iI < 100; iI++)
+		{
+			cSFExact.push_back(iI);
+			assert(cSFExact.capacity() < cSFExact.size() + 8);
+		}
+	}
+	std::cout << "--------------=============== move tests ===============--------------" << std::endl;
+	{
+		xstdtsl::safe_vector<counted> cSFMove;
+		std::cout << "emplace_back and push_back rvalues" << std::endl;
+		for (int iI = 0; iI < 1000; iI++)
+		{
+			if (iI & 1)
+				cSFMove.push_back(counted(iI));
+			else
+				cSFMove.emplace_back(iI - 1,1);
+		}
+		std::cout << "confirm no copies were made during growth" << std::endl;
+		assert(counted::g_nCopies == 0);
+		for (int iI = 0; iI < 1000; iI++)
+			assert(cSFMove.load(iI).m_iValue == iI);
+		std::cout << "confirm store of an rvalue moves" << std::endl;
+		counted::g_nCopies = 0;
+		counted::g_nMoves = 0;
+		cSFMove.store(10,counted(-10));
+		assert(counted::g_nCopies == 0 && counted::g_nMoves == 1);
+		assert(cSFMove.load(10).m_iValue == -10);
+		std::cout << "confirm push_back of an lvalue copies once" << std::endl;
+		counted cValue(5);
+		counted::g_nCopies = 0;
+		cSFMove.push_back(cValue);
+		assert(counted::g_nCopies == 1);
+		std::cout << "emplace_back through write_control" << std::endl;
+		{
+			xstdtsl::safe_vector<counted>::write_control cWrite(cSFMove);
+			cWrite.emplace_back(7);
+			cWrite.push_back(counted(8));
+			cWrite.store(0,counted(100));
+		}
+		assert(cSFMove.size() == 1003);
+		assert(cSFMove.load(1001).m_iValue == 7);
+		assert(cSFMove.load(1002).m_iValue == 8);
+		assert(cSFMove.load(0).m_iValue == 100);
+		std::cout << "move strings into a vector" << std::endl;
+		xstdtsl::safe_vector<std::string> cSFStr;
+		for (int iI = 0; iI < 1000; iI++)
+			cSFStr.push_back(std::string(100,(char)('a' + iI % 26)));
+		cSFStr.emplace_back(5,'z');
+		assert(cSFStr.size() == 1001);
+		assert(cSFStr.load(27) == std::string(100,'b'));
+		assert(cSFStr.load(1000) == "zzzzz");
+	}
+	std::cout << "--------------=============== trivial relocation tests ===============--------------" << std::endl;
+	{
+		std::cout << "confirm relocation of an opted in type does not call move or copy constructors" << std::endl;
+		xstdtsl::safe_vector<relocatable> cSFReloc;
+		for (int iI = 0; iI < 1000; iI++)
+			cSFReloc.emplace_back(iI);
+		counted::g_nCopies = 0;
+		counted::g_nMoves = 0;
+		cSFReloc.reserve(100000);
+		cSFReloc.shrink_to_fit();
+		assert(counted::g_nCopies == 0 && counted::g_nMoves == 0);
+		for (int iI = 0; iI < 1000; iI++)
+			assert(cSFReloc.load(iI).m_iValue == iI);
+		std::cout << "copy construct a vector of a trivially copyable type" << std::endl;
+		xstdtsl::safe_vector<double> cSFDouble;
+		for (int iI = 0; iI < 1000; iI++)
+			cSFDouble.push_back(iI * 0.5);
+		xstdtsl::safe_vector<double> cSFDouble_Copy(cSFDouble);
+		assert(cSFDouble_Copy.size() == 1000);
+		for (int iI = 0; iI < 1000; iI++)
+			assert(cSFDouble_Copy.load(iI) == iI * 0.5);
+		std::cout << "resize with fill" << std::endl;
+		cSFDouble.resize(2000,-1.0);
+		assert(cSFDouble.size() == 2000);
+		assert(cSFDouble.load(999) == 999 * 0.5);
+		for (int iI = 1000; iI < 2000; iI++)
+			assert(cSFDouble.load(iI) == -1.0);
+		cSFDouble.resize(10);
+		assert(cSFDouble.size() == 10);
+		assert(cSFDouble.load(9) == 4.5);
+		xstdtsl::safe_vector<char> cSFChar;
+		cSFChar.resize(100,'q');
+		for (int iI = 0; iI < 100; iI++)
+			assert(cSFChar.load(iI) == 'q');
+		xstdtsl::safe_vector<std::string> cSFStr;
+		cSFStr.resize(50,"abc");
+		cSFStr.resize(25);
+		cSFStr.resize(30);
+		assert(cSFStr.load(24) == "abc");
+		assert(cSFStr.load(29).empty());
+	}
+	std::cout << "--------------=============== range tests ===============--------------" << std::endl;
+	{
+		int iSource[100];
+		for (int iI = 0; iI < 100; iI++)
+			iSource[iI] = iI;
+		xstdtsl::safe_vector<int> cSFRange;
+		std::cout << "append a block" << std::endl;
+		cSFRange.append(iSource,100);
+		assert(cSFRange.size() == 100);
+		std::cout << "append a pointer range" << std::endl;
+		cSFRange.append(iSource + 50,iSource + 100);
+		assert(cSFRange.size() == 150);
+		assert(cSFRange.load(100) == 50);
+		assert(cSFRange.load(149) == 99);
+		std::cout << "append a forward iterator range" << std::endl;
+		std::vector<int> vSource(iSource,iSource + 10);
+		cSFRange.append(vSource.begin(),vSource.end());
+		assert(cSFRange.size() == 160);
+		assert(cSFRange.load(159) == 9);
+		std::cout << "load a range" << std::endl;
+		int iDest[200];
+		assert(cSFRange.load_range(95,10,iDest) == 10);
+		assert(iDest[0] == 95 && iDest[4] == 99 && iDest[5] == 50 && iDest[9] == 54);
+		std::cout << "confirm load past the end is truncated" << std::endl;
+		assert(cSFRange.load_range(155,10,iDest) == 5);
+		assert(cSFRange.load_range(160,10,iDest) == 0);
+		std::cout << "store a range" << std::endl;
+		for (int iI = 0; iI < 200; iI++)
+			iDest[iI] = -iI;
+		assert(cSFRange.store_range(10,iDest,5) == 5);
+		assert(cSFRange.load(9) == 9 && cSFRange.load(10) == 0 && cSFRange.load(14) == -4 && cSFRange.load(15) == 15);
+		assert(cSFRange.store_range(150,iDest,200) == 10);
+		assert(cSFRange.size() == 160);
+		assert(cSFRange.load(159) == -9);
+		std::cout << "append a range whose copy throws, with and without reallocation" << std::endl;
+		{
+			copy_throws cSource[4] = {copy_throws(1),copy_throws(2),copy_throws(-1),copy_throws(3)};
+			int iLive = copy_throws::g_iLive;
+			xstdtsl::safe_vector<copy_throws> cSFThrow;
+			cSFThrow.push_back(copy_throws(7));
+			for (int iPass = 0; iPass < 2; iPass++)
+			{
+				bool bThrown = false;
+				try
+				{
+					cSFThrow.append(cSource,4);
+				}
+				catch (const std::runtime_error &)
+				{
+					bThrown = true;
+				}
+				assert(bThrown);
+				assert(cSFThrow.size() == 1 && cSFThrow.load(0).m_iValue == 7);
+				assert(copy_throws::g_iLive == iLive + 1);
+				cSFThrow.reserve(64);
+			}
+			cSFThrow.append(cSource,2);
+			assert(cSFThrow.size() == 3 && cSFThrow.load(2).m_iValue == 2);
+		}
+		std::cout << "range operations through controls" << std::endl;
+		xstdtsl::safe_vector<std::string> cSFStr;
+		std::string sSource[3] = {"a","b","c"};
+		{
+			xstdtsl::safe_vector<std::string>::write_control cWrite(cSFStr);
+			cWrite.append(sSource,3);
+			cWrite.append(sSource,sSource + 3);
+			cWrite.store_range(4,sSource,2);
+			std::string sDest[6];
+			assert(cWrite.load_range(0,6,sDest) == 6);
+			assert(sDest[0] == "a" && sDest[3] == "a" && sDest[4] == "a" && sDest[5] == "b");
+		}
+		{
+			xstdtsl::safe_vector<std::string>::read_control cRead(cSFStr);
+			std::string sDest[2];
+			assert(cRead.load_range(1,2,sDest) == 2);
+			assert(sDest[0] == "b" && sDest[1] == "c");
+		}
+	}
+	std::cout << "--------------=============== huge page tests ===============--------------" << std::endl;
+	{
+		size_t nOld_Threshold = xstdtsl_get_huge_page_threshold();
+		std::cout << "huge pages available: " << (xstdtsl_huge_pages_available() ? "yes" : "no") << std::endl;
+		std::cout << "confirm threshold can be set" << std::endl;
+		xstdtsl_set_huge_page_threshold(64 * 1024);
+		assert(xstdtsl_get_huge_page_threshold() == 64 * 1024);
+		std::cout << "grow a vector beyond the threshold" << std::endl;
+		xstdtsl::safe_vector<int64_t> cSFHuge;
+		for (int64_t iI = 0; iI < 200000; iI++)
+			cSFHuge.push_back(iI);
+		std::cout << "confirm contents" << std::endl;
+		for (int64_t iI = 0; iI < 200000; iI++)
+			assert(cSFHuge.load(iI) == iI);
+		std::cout << "change placement policy of a huge page backed vector" << std::endl;
+		cSFHuge.set_numa_policy(XSTDTSL_NUMA_INTERLEAVE);
+		for (int64_t iI = 0; iI < 200000; iI++)
+			assert(cSFHuge.load(iI) == iI);
+		std::cout << "copy a huge page backed vector" << std::endl;
+		xstdtsl::safe_vector<int64_t> cSFHuge_Copy(cSFHuge);
+		for (int64_t iI = 0; iI < 200000; iI++)
+			assert(cSFHuge_Copy.load(iI) == iI);
+		std::cout << "clear and shrink" << std::endl;
+		cSFHuge.clear();
+		cSFHuge.shrink_to_fit();
+		assert(cSFHuge.size() == 0);
+		std::cout << "confirm block allocation round trip" << std::endl;
+		int iKind = -1;
+		void * pBlock = xstdtsl_block_alloc(1024 * 1024,XSTDTSL_NUMA_DEFAULT,0,&iKind);
+		assert(pBlock != nullptr);
+		assert(iKind == XSTDTSL_BLOCK_MAPPED || !xstdtsl_huge_pages_available());
+		std::memset(pBlock,0x5a,1024 * 1024);
+		xstdtsl_block_free(pBlock,1024 * 1024,iKind);
+		xstdtsl_set_huge_page_threshold(0);
+		pBlock = xstdtsl_block_alloc(1024 * 1024,XSTDTSL_NUMA_DEFAULT,0,&iKind);
+		assert(iKind == XSTDTSL_BLOCK_HEAP);
+		xstdtsl_block_free(pBlock,1024 * 1024,iKind);
+		std::cout << "confirm placed blocks have their own mappings" << std::endl;
+		pBlock = xstdtsl_block_alloc(1000,XSTDTSL_NUMA_LOCAL,0,&iKind);
+		assert(pBlock != nullptr && (iKind == XSTDTSL_BLOCK_NUMA || iKind == XSTDTSL_BLOCK_HEAP));
+		assert(iKind != XSTDTSL_BLOCK_NUMA || reinterpret_cast<uintptr_t>(pBlock) % xstdtsl_get_page_size() == 0);
+		std::memset(pBlock,0x5a,1000);
+		xstdtsl_block_free(pBlock,1000,iKind);
+		pBlock = xstdtsl_block_alloc_aligned(1000,4 * xstdtsl_get_page_size(),XSTDTSL_NUMA_INTERLEAVE,0,&iKind);
+		assert(pBlock != nullptr && reinterpret_cast<uintptr_t>(pBlock) % (4 * xstdtsl_get_page_size()) == 0);
+		xstdtsl_block_free(pBlock,1000,iKind);
+		pBlock = xstdtsl_numa_alloc(3000,XSTDTSL_NUMA_LOCAL,0);
+		assert(pBlock != nullptr);
+		std::memset(pBlock,0x5a,3000);
+		xstdtsl_numa_free(pBlock,3000,XSTDTSL_NUMA_LOCAL);
+		xstdtsl_set_huge_page_threshold(nOld_Threshold);
+	}
+	std::cout << "--------------=============== parallel algorithm tests ===============--------------" << std::endl;
+	{
+		std::cout << "set the parallel thread count" << std::endl;
+		xstdtsl_set_parallel_threads(4);
+		assert(xstdtsl_get_parallel_threads() == 4);
+		const int64_t iCount = 200003;
+		xstdtsl::safe_vector<int64_t> cSFParallel;
+		std::vector<int64_t> vReference(iCount);
+		for (int64_t iI = 0; iI < iCount; iI++)
+		{
+			vReference[iI] = (iI * 7919) % 100003 - 50000;
+			cSFParallel.push_back(vReference[iI]);
+		}
+		std::cout << "parallel_for_each" << std::endl;
+		cSFParallel.parallel_for_each([](int64_t & io_iValue) { io_iValue *= 2; });
+		for (auto & iValue : vReference)
+			iValue *= 2;
+		for (int64_t iI = 0; iI < iCount; iI += 97)
+			assert(cSFParallel.load(iI) == vReference[iI]);
+		std::atomic<int64_t> iVisited(0);
+		const xstdtsl::safe_vector<int64_t> & cSFConst = cSFParallel;
+		cSFConst.parallel_for_each([&iVisited](const int64_t &) { iVisited++; });
+		assert(iVisited == iCount);
+		std::cout << "parallel_reduce" << std::endl;
+		assert(cSFParallel.parallel_reduce() == std::accumulate(vReference.begin(),vReference.end(),(int64_t)0));
+		assert(cSFParallel.parallel_reduce((int64_t)5) == std::accumulate(vReference.begin(),vReference.end(),(int64_t)5));
+		assert(cSFParallel.parallel_reduce(vReference[0],[](int64_t i_iA, int64_t i_iB) { return std::max(i_iA,i_iB); }) == *std::max_element(vReference.begin(),vReference.end()));
+		std::cout << "parallel_transform into a vector of another type" << std::endl;
+		xstdtsl::safe_vector<double> cSFHalf;
+		cSFParallel.parallel_transform(cSFHalf,[](int64_t i_iValue) { return i_iValue * 0.5; });
+		assert(cSFHalf.size() == (size_t)iCount);
+		for (int64_t iI = 0; iI < iCount; iI += 101)
+			assert(cSFHalf.load(iI) == vReference[iI] * 0.5);
+		std::cout << "parallel_transform in place" << std::endl;
+		cSFParallel.parallel_transform(cSFParallel,[](int64_t i_iValue) { return i_iValue + 1; });
+		for (auto & iValue : vReference)
+			iValue += 1;
+		for (int64_t iI = 0; iI < iCount; iI += 89)
+			assert(cSFParallel.load(iI) == vReference[iI]);
+		std::cout << "parallel_inclusive_scan and parallel_exclusive_scan" << std::endl;
+		xstdtsl::safe_vector<int64_t> cSFScan(cSFParallel);
+		cSFScan.parallel_inclusive_scan();
+		std::vector<int64_t> vScan(iCount);
+		std::partial_sum(vReference.begin(),vReference.end(),vScan.begin());
+		for (int64_t iI = 0; iI < iCount; iI++)
+			assert(cSFScan.load(iI) == vScan[iI]);
+		cSFScan = cSFParallel;
+		cSFScan.parallel_exclusive_scan(10);
+		int64_t iRunning = 10;
+		for (int64_t iI = 0; iI < iCount; iI++)
+		{
+			assert(cSFScan.load(iI) == iRunning);
+			iRunning += vReference[iI];
+		}
+		std::cout << "parallel_sort" << std::endl;
+		cSFParallel.parallel_sort();
+		std::sort(vReference.begin(),vReference.end());
+		for (int64_t iI = 0; iI < iCount; iI++)
+			assert(cSFParallel.load(iI) == vReference[iI]);
+		cSFParallel.parallel_sort(std::greater<int64_t>());
+		for (int64_t iI = 0; iI < iCount; iI++)
+			assert(cSFParallel.load(iI) == vReference[iCount - 1 - iI]);
+		std::cout << "parallel_sort of strings" << std::endl;
+		xstdtsl::safe_vector<std::string> cSFStrings;
+		std::vector<std::string> vStrings;
+		for (int iI = 0; iI < 50000; iI++)
+		{
+			vStrings.push_back(std::to_string((iI * 7919) % 50021) + "-suffix-to-defeat-small-strings");
+			cSFStrings.push_back(vStrings.back());
+		}
+		cSFStrings.parallel_sort();
+		std::sort(vStrings.begin(),vStrings.end());
+		for (int iI = 0; iI < 50000; iI++)
+			assert(cSFStrings.load(iI) == vStrings[iI]);
+		std::cout << "parallel algorithms through controls" << std::endl;
+		{
+			xstdtsl::safe_vector<int64_t>::write_control cWrite(cSFParallel);
+			cWrite.parallel_sort();
+			cWrite.parallel_for_each([](int64_t & io_iValue) { io_iValue = 1; });
+			cWrite.parallel_inclusive_scan();
+			assert(cWrite.load(iCount - 1) == iCount);
+			cWrite.parallel_for_each([](int64_t & io_iValue) { io_iValue = 1; });
+			cWrite.parallel_exclusive_scan(0);
+			assert(cWrite.load(iCount - 1) == iCount - 1);
+			assert(cWrite.parallel_reduce() == (iCount - 1) * iCount / 2);
+		}
+		std::cout << "confirm exceptions thrown by tasks reach the caller" << std::endl;
+		bool bCaught = false;
+		try
+		{
+			cSFParallel.parallel_for_each([](int64_t & io_iValue) { if (io_iValue == 1000) throw std::runtime_error("test"); });
+		}
+		catch (const std::runtime_error &)
+		{
+			bCaught = true;
+		}
+		assert(bCaught);
+		std::cout << "small and empty vectors" << std::endl;
+		xstdtsl::safe_vector<int> cSFSmall;
+		cSFSmall.parallel_sort();
+		cSFSmall.parallel_inclusive_scan();
+		assert(cSFSmall.parallel_reduce(3) == 3);
+		cSFSmall.push_back(3);
+		cSFSmall.push_back(1);
+		cSFSmall.push_back(2);
+		cSFSmall.parallel_sort();
+		assert(cSFSmall.load(0) == 1 && cSFSmall.load(2) == 3);
+		cSFSmall.parallel_exclusive_scan(0);
+		assert(cSFSmall.load(0) == 0 && cSFSmall.load(1) == 1 && cSFSmall.load(2) == 3);
+		xstdtsl_set_parallel_threads(0);
+	}
+	std::cout << "--------------=============== allocator tests ===============--------------" << std::endl;
+	{
+		std::cout << "confirm allocator detection" << std::endl;
+		static_assert(xstdtsl::allocator_can_expand<xstdtsl::arena_allocator<int>>::value,"arena allocator grows in place");
+		static_assert(!xstdtsl::allocator_can_expand<std::allocator<int>>::value,"std::allocator does not grow in place");
+		static_assert(std::is_same<xstdtsl::safe_vector<int>,xstdtsl::safe_vector<int,xstdtsl::block_allocator<int>>>::value,"default allocator");
+		std::cout << "vector with std::allocator" << std::endl;
+		xstdtsl::safe_vector<std::string,std::allocator<std::string>> cSFStd;
+		for (int iI = 0; iI < 1000; iI++)
+			cSFStd.push_back(std::to_string(iI));
+		assert(cSFStd.load(999) == "999");
+		xstdtsl::safe_vector<std::string,std::allocator<std::string>> cSFStd_Copy(cSFStd);
+		assert(cSFStd_Copy.load(500) == "500");
+		std::cout << "vector on an arena grows in place" << std::endl;
+		xstdtsl::arena cArena(1024 * 1024);
+		{
+			xstdtsl::safe_vector<int64_t,xstdtsl::arena_allocator<int64_t>> cSFArena{xstdtsl::arena_allocator<int64_t>(cArena)};
+			for (int64_t iI = 0; iI < 100000; iI++)
+				cSFArena.push_back(iI);
+			// growth in place means the arena only ever holds one block for the vector
+			assert(cArena.allocated() == 1024 * 1024);
+			for (int64_t iI = 0; iI < 100000; iI += 7)
+				assert(cSFArena.load(iI) == iI);
+			assert(&cSFArena.get_allocator().get_arena() == &cArena);
+			std::cout << "arena vector copy, parallel transform and sort" << std::endl;
+			xstdtsl::safe_vector<int64_t,xstdtsl::arena_allocator<int64_t>> cSFArena_Copy(cSFArena);
+			assert(cSFArena_Copy.size() == 100000);
+			xstdtsl::safe_vector<int64_t> cSFNegated;
+			cSFArena.parallel_transform(cSFNegated,[](int64_t i_iValue) { return -i_iValue; });
+			assert(cSFNegated.load(99999) == -99999);
+			cSFArena_Copy.parallel_sort(std::greater<int64_t>());
+			assert(cSFArena_Copy.load(0) == 99999);
+			cSFArena_Copy.clear();
+			cSFArena_Copy.shrink_to_fit();
+		}
+		cArena.reset();
+		assert(cArena.allocated() == 0);
+		std::cout << "vector on a pmr memory resource" << std::endl;
+		std::pmr::monotonic_buffer_resource cResource(65536);
+		xstdtsl::pmr::safe_vector<int> cSFPmr{std::pmr::polymorphic_allocator<int>(&cResource)};
+		for (int iI = 0; iI < 10000; iI++)
+			cSFPmr.push_back(iI);
+		assert(cSFPmr.find(4321) == 4321);
+		assert(cSFPmr.get_allocator().resource() == &cResource);
+	}
+	std::cout << "--------------=============== alignment tests ===============--------------" << std::endl;
+	{
+		std::cout << "confirm the cache line size is a power of two" << std::endl;
+		size_t nLine = xstdtsl_get_cache_line_size();
+		assert(nLine >= 16 && (nLine & (nLine - 1)) == 0);
+		std::cout << "confirm large vectors are cache line aligned through growth" << std::endl;
+		xstdtsl::safe_vector<int32_t> cSFLarge;
+		for (int32_t iI = 0; iI < 100000; iI++)
+		{
+			cSFLarge.push_back(iI);
+			if ((iI & (iI + 1)) == 0 && sizeof(int32_t) * cSFLarge.capacity() >= 4096)
+			{
+				assert(cSFLarge.get_alignment() == nLine);
+				assert(first_element_address(cSFLarge) % nLine == 0);
+			}
+		}
+		assert(cSFLarge.find(99999) == 99999);
+		std::cout << "confirm an explicit alignment applies at every size" << std::endl;
+		xstdtsl::aligned_safe_vector<float,256> cSFAligned;
+		for (int iI = 0; iI < 5000; iI++)
+		{
+			cSFAligned.push_back((float)iI);
+			if (iI % 333 == 0)
+				assert(first_element_address(cSFAligned) % 256 == 0);
+		}
+		assert(cSFAligned.get_alignment() == 256);
+		std::cout << "alignment is kept by reserve, shrink_to_fit, copies and placement changes" << std::endl;
+		cSFAligned.reserve(100000);
+		assert(first_element_address(cSFAligned) % 256 == 0);
+		cSFAligned.shrink_to_fit();
+		assert(first_element_address(cSFAligned) % 256 == 0);
+		xstdtsl::aligned_safe_vector<float,256> cSFAligned_Copy(cSFAligned);
+		assert(first_element_address(cSFAligned_Copy) % 256 == 0);
+		assert(cSFAligned_Copy.load(4999) == 4999.0f);
+		cSFAligned.set_numa_policy(XSTDTSL_NUMA_INTERLEAVE);
+		assert(first_element_address(cSFAligned) % 256 == 0);
+		cSFAligned.resize(20000,1.0f);
+		assert(first_element_address(cSFAligned) % 256 == 0);
+		assert(cSFAligned.load(19999) == 1.0f);
+		std::cout << "confirm over-aligned types are aligned in small vectors" << std::endl;
+		xstdtsl::safe_vector<cache_line> cSFLines;
+		cSFLines.push_back(cache_line());
+		assert(cSFLines.get_alignment() >= alignof(cache_line));
+		assert(first_element_address(cSFLines) % alignof(cache_line) == 0);
+		std::cout << "confirm aligned block allocation round trip" << std::endl;
+		int iKind = -1;
+		void * pBlock = xstdtsl_block_alloc_aligned(1000,512,XSTDTSL_NUMA_DEFAULT,0,&iKind);
+		assert(pBlock != nullptr && reinterpret_cast<uintptr_t>(pBlock) % 512 == 0);
+		assert(iKind == XSTDTSL_BLOCK_ALIGNED);
+		std::memset(pBlock,0,1000);
+		xstdtsl_block_free(pBlock,1000,iKind);
+		assert(xstdtsl_block_alloc_aligned(1000,3,XSTDTSL_NUMA_DEFAULT,0,&iKind) == nullptr);
+	}
+	std::cout << "--------------=============== lock striping tests ===============--------------" << std::endl;
+	{
+		std::cout << "confirm striping configuration" << std::endl;
+		xstdtsl::safe_vector<int64_t> cSFStriped;
+		assert(cSFStriped.get_lock_stripes() == 0);
+		cSFStriped.set_lock_stripes(6,100);
+		assert(cSFStriped.get_lock_stripes() == 8);
+		assert(cSFStriped.get_lock_stripe_range() == 128);
+		cSFStriped.set_lock_stripes(16);
+		assert(cSFStriped.get_lock_stripes() == 16);
+		assert(cSFStriped.get_lock_stripe_range() == xstdtsl_get_page_size() / sizeof(int64_t));
+		cSFStriped.set_lock_stripes(0);
+		assert(cSFStriped.get_lock_stripes() == 0);
+		assert(cSFStriped.get_lock_stripe_range() == 0);
+		std::cout << "concurrent stores to disjoint and overlapping regions" << std::endl;
+		cSFStriped.set_lock_stripes(8,64);
+		cSFStriped.resize(65536,0);
+		std::vector<std::thread> vThreads;
+		for (int64_t iT = 0; iT < 4; iT++)
+		{
+			vThreads.emplace_back([&cSFStriped,iT]()
+			{
+				int64_t lpiBlock[100];
+				for (int64_t iI = 0; iI < 100; iI++)
+					lpiBlock[iI] = iT + 1;
+				for (int iPass = 0; iPass < 10; iPass++)
+				{
+					for (int64_t iI = iT * 16384; iI < (iT + 1) * 16384; iI++)
+						cSFStriped.store(iI,iT + 1);
+					// ranges that cross stripes and wrap around the stripe set
+					for (int64_t iI = iT * 16384; iI + 100 <= (iT + 1) * 16384; iI += 1000)
+						assert(cSFStriped.store_range(iI,lpiBlock,100) == 100);
+					assert(cSFStriped.load(iT * 16384) == iT + 1);
+				}
+			});
+		}
+		vThreads.emplace_back([&cSFStriped]()
+		{
+			for (int iPass = 0; iPass < 20; iPass++)
+			{
+				int64_t lpiOut[300];
+				cSFStriped.load_range(1000,300,lpiOut);
+				cSFStriped.find(-1);
+			}
+		});
+		for (auto & cThread : vThreads)
+			cThread.join();
+		for (int64_t iT = 0; iT < 4; iT++)
+			assert(cSFStriped.find(iT + 1) == (size_t)(iT * 16384));
+		assert(cSFStriped.parallel_reduce() == 16384 * (1 + 2 + 3 + 4));
+		std::cout << "confirm a read control excludes striped stores" << std::endl;
+		std::atomic<bool> bStored(false);
+		std::thread cWriter;
+		{
+			xstdtsl::safe_vector<int64_t>::read_control cRead(cSFStriped);
+			cWriter = std::thread([&cSFStriped,&bStored]()
+			{
+				cSFStriped.store(5,-5);
+				bStored = true;
+			});
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+			assert(!bStored);
+			assert(cRead.load(5) == 1);
+		}
+		cWriter.join();
+		assert(bStored);
+		assert(cSFStriped.load(5) == -5);
+		std::cout << "growth while storing" << std::endl;
+		std::thread cGrower([&cSFStriped]()
+		{
+			for (int64_t iI = 0; iI < 100000; iI++)
+				cSFStriped.push_back(iI);
+		});
+		for (int64_t iI = 0; iI < 65536; iI += 3)
+			cSFStriped.store(iI,7);
+		cGrower.join();
+		assert(cSFStriped.size() == 165536);
+		assert(cSFStriped.load(3) == 7 && cSFStriped.load(165535) == 99999);
+		std::cout << "copy a striped vector" << std::endl;
+		xstdtsl::safe_vector<int64_t> cSFCopy(cSFStriped);
+		assert(cSFCopy.get_lock_stripes() == 0);
+		assert(cSFCopy.load(165535) == 99999);
+	}
+	std::cout << "--------------=============== inline storage tests ===============--------------" << std::endl;
+	{
+		std::cout << "confirm inline storage adds nothing when not used" << std::endl;
+		static_assert(sizeof(xstdtsl::safe_vector<int32_t,xstdtsl::block_allocator<int32_t>,0,0>) == sizeof(xstdtsl::safe_vector<int64_t>),"an inline capacity of 0 must not change the size of the vector");
+		static_assert(sizeof(xstdtsl::small_safe_vector<int32_t,8>) >= sizeof(xstdtsl::safe_vector<int32_t>) + 8 * sizeof(int32_t),"inline storage must be within the vector");
+		std::cout << "fill the inline storage without allocating" << std::endl;
+		xstdtsl::arena cArena;
+		xstdtsl::safe_vector<int32_t,xstdtsl::arena_allocator<int32_t>,0,8> cSFSmall{xstdtsl::arena_allocator<int32_t>(cArena)};
+		uintptr_t uObject_Start = reinterpret_cast<uintptr_t>(&cSFSmall);
+		uintptr_t uObject_End = uObject_Start + sizeof(cSFSmall);
+		for (int32_t iI = 0; iI < 8; iI++)
+			cSFSmall.push_back(iI);
+		assert(cArena.allocated() == 0);
+		assert(cSFSmall.capacity() == 8);
+		uintptr_t uFirst = first_element_address(cSFSmall);
+		assert(uFirst >= uObject_Start && uFirst < uObject_End);
+		std::cout << "spill to the data block past the inline capacity" << std::endl;
+		cSFSmall.push_back(8);
+		assert(cArena.allocated() > 0);
+		assert(cSFSmall.capacity() >= 9);
+		uFirst = first_element_address(cSFSmall);
+		assert(uFirst < uObject_Start || uFirst >= uObject_End);
+		for (int32_t iI = 0; iI < 9; iI++)
+			assert(cSFSmall.load(iI) == iI);
+		std::cout << "return to the inline storage on shrink_to_fit" << std::endl;
+		cSFSmall.resize(5);
+		cSFSmall.shrink_to_fit();
+		assert(cSFSmall.capacity() == 8);
+		uFirst = first_element_address(cSFSmall);
+		assert(uFirst >= uObject_Start && uFirst < uObject_End);
+		assert(cSFSmall.load(4) == 4 && cSFSmall.size() == 5);
+		cSFSmall.shrink_to_fit();
+		assert(cSFSmall.load(4) == 4);
+		std::cout << "inline storage keeps its place on a placement change" << std::endl;
+		xstdtsl::small_safe_vector<int64_t,4> cSFPlaced;
+		cSFPlaced.push_back(1);
+		uObject_Start = reinterpret_cast<uintptr_t>(&cSFPlaced);
+		cSFPlaced.set_numa_policy(XSTDTSL_NUMA_INTERLEAVE);
+		assert(first_element_address(cSFPlaced) >= uObject_Start && first_element_address(cSFPlaced) < uObject_Start + sizeof(cSFPlaced));
+		assert(cSFPlaced.load(0) == 1);
+		assert(cSFPlaced.get_alignment() >= alignof(int64_t));
+		std::cout << "iterators, controls, copies and algorithms on small vectors" << std::endl;
+		xstdtsl::small_safe_vector<std::string,4> cSFStrings;
+		cSFStrings.push_back("c");
+		cSFStrings.push_back("a");
+		cSFStrings.push_back("b");
+		{
+			xstdtsl::small_safe_vector<std::string,4>::write_control cWrite(cSFStrings);
+			cWrite.push_back("d");
+			cWrite.store(0,std::string(40,'c'));
+		}
+		std::string sJoined;
+		{
+			xstdtsl::small_safe_vector<std::string,4>::read_iterator cIter(cSFStrings,xstdtsl::small_safe_vector<std::string,4>::iterator_base::beginning);
+			while (!cIter.is_at_end())
+			{
+				sJoined += cIter.load().substr(0,1);
+				cIter++;
+			}
+		}
+		assert(sJoined == "cabd");
+		xstdtsl::small_safe_vector<std::string,4> cSFStrings_Copy(cSFStrings);
+		cSFStrings.push_back("e");
+		assert(cSFStrings.size() == 5 && cSFStrings.load(0) == std::string(40,'c'));
+		assert(cSFStrings_Copy.size() == 4 && cSFStrings_Copy.load(3) == "d");
+		cSFStrings_Copy = cSFStrings;
+		assert(cSFStrings_Copy.size() == 5);
+		cSFStrings.parallel_sort();
+		assert(cSFStrings.load(0) == "a" && cSFStrings.load(4) == "e");
+		cSFStrings.clear();
+		cSFStrings.shrink_to_fit();
+		assert(cSFStrings.empty());
+		assert(cSFStrings_Copy.find("e") == 4);
+	}
+	std::cout << "--------------=============== zero-copy access tests ===============--------------" << std::endl;
+	{
+		xstdtsl::safe_vector<counted> cSVCounted;
+		for (int iI = 0; iI < 100; iI++)
+			cSVCounted.emplace_back(iI);
+		counted::g_nCopies = 0;
+		std::cout << "read through the pointer and span of a read control" << std::endl;
+		{
+			xstdtsl::safe_vector<counted>::read_control cRead(cSVCounted);
+			const counted * pData = cRead.data();
+			xstdtsl::span<const counted> cView = cRead.view();
+			assert(pData == cView.data());
+			assert(cView.size() == 100);
+			int iSum = 0;
+			for (const counted & cElement : cView)
+				iSum += cElement.m_iValue;
+			assert(iSum == 4950);
+			assert(pData[42].m_iValue == 42);
+		}
+		assert(counted::g_nCopies == 0);
+		std::cout << "modify through the span of a write control" << std::endl;
+		{
+			xstdtsl::safe_vector<counted>::write_control cWrite(cSVCounted);
+			for (counted & cElement : cWrite.view())
+				cElement.m_iValue *= 2;
+			cWrite.data()[0].m_iValue = -1;
+		}
+		assert(counted::g_nCopies == 0);
+		assert(cSVCounted.load(0).m_iValue == -1);
+		assert(cSVCounted.load(99).m_iValue == 198);
+		std::cout << "visit single elements and runs" << std::endl;
+		counted::g_nCopies = 0;
+		int iVisited = 0;
+		assert(cSVCounted.visit(10,[&iVisited](const counted & i_cElement) { iVisited = i_cElement.m_iValue; }));
+		assert(iVisited == 20);
+		assert(!cSVCounted.visit(100,[&iVisited](const counted &) { iVisited = -2; }));
+		assert(iVisited == 20);
+		int iRun_Sum = 0;
+		assert(cSVCounted.visit_range(95,10,[&iRun_Sum](xstdtsl::span<const counted> i_cRun)
+		{
+			for (const counted & cElement : i_cRun)
+				iRun_Sum += cElement.m_iValue;
+		}) == 5);
+		assert(iRun_Sum == 2 * (95 + 96 + 97 + 98 + 99));
+		assert(cSVCounted.visit_range(100,1,[&iRun_Sum](xstdtsl::span<const counted>) { iRun_Sum = 0; }) == 0);
+		assert(iRun_Sum != 0);
+		assert(counted::g_nCopies == 0);
+		std::cout << "visit a striped vector and an empty vector" << std::endl;
+		xstdtsl::safe_vector<int> cSVStriped;
+		cSVStriped.set_lock_stripes(4,16);
+		for (int iI = 0; iI < 100; iI++)
+			cSVStriped.push_back(iI);
+		assert(cSVStriped.visit_range(10,40,[](xstdtsl::span<const int> i_cRun) { assert(i_cRun[0] == 10 && i_cRun[39] == 49); }) == 40);
+		xstdtsl::safe_vector<int> cSVEmpty;
+		{
+			xstdtsl::safe_vector<int>::read_control cRead(cSVEmpty);
+			assert(cRead.view().empty());
+		}
+		assert(!cSVEmpty.visit(0,[](const int &) { assert(false); }));
+	}
+	std::cout << "--------------=============== insert and erase tests ===============--------------" << std::endl;
+	{
+		std::cout << "insert single elements at the front, middle and back" << std::endl;
+		xstdtsl::safe_vector<int> cSVInt;
+		for (int iI = 0; iI < 10; iI++)
+			cSVInt.push_back(iI);
+		assert(cSVInt.insert(0,-1));
+		assert(cSVInt.insert(6,100));
+		assert(cSVInt.insert(cSVInt.size(),200));
+		assert(!cSVInt.insert(cSVInt.size() + 1,300));
+		assert(cSVInt.size() == 13);
+		assert(cSVInt.load(0) == -1 && cSVInt.load(1) == 0 && cSVInt.load(6) == 100 && cSVInt.load(7) == 5 && cSVInt.load(12) == 200);
+		std::cout << "insert a block and a range, with and without reallocation" << std::endl;
+		int iBlock[5] = {1000,1001,1002,1003,1004};
+		cSVInt.reserve(100);
+		assert(cSVInt.insert(2,iBlock,5));
+		assert(cSVInt.size() == 18 && cSVInt.load(2) == 1000 && cSVInt.load(6) == 1004 && cSVInt.load(7) == 1);
+		std::vector<int> vRange(200,7);
+		assert(cSVInt.insert(1,vRange.begin(),vRange.end()));
+		assert(cSVInt.size() == 218 && cSVInt.load(0) == -1 && cSVInt.load(1) == 7 && cSVInt.load(200) == 7 && cSVInt.load(201) == 0 && cSVInt.load(217) == 200);
+		std::istringstream cInput("5 6 7");
+		assert(cSVInt.insert(0,std::istream_iterator<int>(cInput),std::istream_iterator<int>()));
+		assert(cSVInt.size() == 221 && cSVInt.load(0) == 5 && cSVInt.load(2) == 7 && cSVInt.load(3) == -1);
+		std::cout << "insert elements of the vector into itself" << std::endl;
+		xstdtsl::safe_vector<int> cSVSelf;
+		for (int iI = 0; iI < 8; iI++)
+			cSVSelf.push_back(iI);
+		{
+			xstdtsl::safe_vector<int>::write_control cWrite(cSVSelf);
+			const int & iFirst = cWrite.data()[0];
+			assert(cWrite.insert(4,iFirst));
+			assert(cWrite.insert(0,cWrite.data() + 6,3));
+		}
+		// 0 1 2 3 0 4 5 6 7 -> 5 6 7 0 1 2 3 0 4 5 6 7
+		int iExpected[12] = {5,6,7,0,1,2,3,0,4,5,6,7};
+		assert(cSVSelf.size() == 12);
+		for (int iI = 0; iI < 12; iI++)
+			assert(cSVSelf.load(iI) == iExpected[iI]);
+		std::cout << "erase runs" << std::endl;
+		assert(cSVSelf.erase(3,4) == 4);
+		assert(cSVSelf.size() == 8 && cSVSelf.load(2) == 7 && cSVSelf.load(3) == 0 && cSVSelf.load(4) == 4);
+		assert(cSVSelf.erase(6,10) == 2);
+		assert(cSVSelf.erase(6) == 0);
+		assert(cSVSelf.erase(0) == 1);
+		assert(cSVSelf.size() == 5 && cSVSelf.load(0) == 6 && cSVSelf.load(4) == 5);
+		std::cout << "erase_if in one compacting pass" << std::endl;
+		xstdtsl::safe_vector<int> cSVEven;
+		for (int iI = 0; iI < 1000; iI++)
+			cSVEven.push_back(iI);
+		assert(cSVEven.erase_if([](const int & i_iValue) { return i_iValue % 2 == 1; }) == 500);
+		assert(cSVEven.size() == 500);
+		for (int iI = 0; iI < 500; iI++)
+			assert(cSVEven.load(iI) == iI * 2);
+		assert(cSVEven.erase_if([](const int &) { return false; }) == 0);
+		assert(cSVEven.erase_if([](const int &) { return true; }) == 500);
+		assert(cSVEven.empty());
+	}
+	{
+		std::cout << "insert and erase elements that own memory" << std::endl;
+		xstdtsl::safe_vector<std::string> cSVString;
+		for (int iI = 0; iI < 20; iI++)
+			cSVString.push_back(std::string(40,(char)('a' + iI)));
+		std::string sMoved(40,'z');
+		assert(cSVString.insert(10,std::move(sMoved)));
+		assert(cSVString.emplace(0,(size_t)3,'y'));
+		assert(cSVString.size() == 22 && cSVString.load(0) == "yyy" && cSVString.load(11) == std::string(40,'z') && cSVString.load(12) == std::string(40,'k'));
+		{
+			xstdtsl::safe_vector<std::string>::write_control cWrite(cSVString);
+			assert(cWrite.insert(5,cWrite.data()[1]));
+			assert(cWrite.erase(0,2) == 2);
+			assert(cWrite.erase_if([](const std::string & i_sValue) { return i_sValue[0] == 'a' || i_sValue[0] == 'b' || i_sValue[0] == 'z'; }) == 3);
+		}
+		assert(cSVString.size() == 18);
+		for (int iI = 0; iI < 18; iI++)
+			assert(cSVString.load(iI) == std::string(40,(char)('c' + iI)));
+		std::cout << "a throwing predicate leaves the untested elements in place" << std::endl;
+		bool bThrown = false;
+		try
+		{
+			cSVString.erase_if([](const std::string & i_sValue)
+			{
+				if (i_sValue[0] == 'h')
+					throw std::runtime_error("predicate");
+				return i_sValue[0] == 'd';
+			});
+		}
+		catch (const std::runtime_error &)
+		{
+			bThrown = true;
+		}
+		assert(bThrown);
+		assert(cSVString.size() == 17 && cSVString.load(0)[0] == 'c' && cSVString.load(1)[0] == 'e' && cSVString.load(16)[0] == 't');
+	}
+	{
+		std::cout << "confirm elements are moved, not copied, when shifted" << std::endl;
+		xstdtsl::safe_vector<counted> cSVCounted;
+		cSVCounted.reserve(64);
+		for (int iI = 0; iI < 32; iI++)
+			cSVCounted.emplace_back(iI);
+		counted::g_nCopies = 0;
+		assert(cSVCounted.emplace(0,-1));
+		assert(cSVCounted.erase(0,4) == 4);
+		assert(cSVCounted.erase_if([](const counted & i_cValue) { return i_cValue.m_iValue % 4 == 0; }) == 7);
+		assert(counted::g_nCopies == 0);
+		assert(cSVCounted.size() == 22 && cSVCounted.load(0).m_iValue == 3 && cSVCounted.load(1).m_iValue == 5);
+		std::cout << "confirm trivially relocatable elements are shifted without moves" << std::endl;
+		xstdtsl::safe_vector<relocatable> cSVRelocatable;
+		for (int iI = 0; iI < 32; iI++)
+			cSVRelocatable.emplace_back(iI);
+		counted::g_nMoves = 0;
+		counted::g_nCopies = 0;
+		assert(cSVRelocatable.insert(0,relocatable(-1)));
+		assert(cSVRelocatable.erase(10,5) == 5);
+		// the inserted value is moved into a temporary and then into place; the shifts add no moves
+		assert(counted::g_nMoves == 2 && counted::g_nCopies == 0);
+		assert(cSVRelocatable.size() == 28 && cSVRelocatable.load(0).m_iValue == -1 && cSVRelocatable.load(10).m_iValue == 14);
+	}
+
 
-		
 	return 0;	
 }
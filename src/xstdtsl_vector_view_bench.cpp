@@ -0,0 +1,111 @@
+#include <xstdtsl_safe_vector>
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <cstdint>
+#include <string>
+
+///
+/// a large trivially copyable element; when load() is inlined the compiler may elide most of its copy
+///
+struct wide_record
+{
+	int64_t	m_lliValues[32];
+};
+
+///
+/// time repeated passes of a function
+/// \returns the mean time per element in nanoseconds
+///
+template <class F> double time_per_element(size_t i_nElements, size_t i_nPasses, F i_fnPass)
+{
+	auto tStart = std::chrono::steady_clock::now();
+	for (size_t nI = 0; nI < i_nPasses; nI++)
+		i_fnPass();
+	return std::chrono::duration<double,std::nano>(std::chrono::steady_clock::now() - tStart).count() / (double)(i_nElements * i_nPasses);
+}
+
+///
+/// scan one value of every element of a vector by each access method and print a table row
+///
+template <class T, class V> void scan(const char * i_pName, xstdtsl::safe_vector<T> & io_cVector, size_t i_nPasses, V i_fnValue)
+{
+	typedef xstdtsl::safe_vector<T> vector_type;
+	size_t nElements = io_cVector.size();
+	volatile int64_t iSink = 0;
+	double dIterator = time_per_element(nElements,i_nPasses,[&]()
+	{
+		int64_t iSum = 0;
+		typename vector_type::read_iterator cIter(io_cVector,vector_type::iterator_base::beginning);
+		while (!cIter.is_at_end())
+		{
+			iSum += i_fnValue(cIter.load());
+			cIter++;
+		}
+		iSink = iSink + iSum;
+	});
+	double dLoad = time_per_element(nElements,i_nPasses,[&]()
+	{
+		int64_t iSum = 0;
+		typename vector_type::read_control cRead(io_cVector);
+		for (size_t nI = 0; nI < cRead.size(); nI++)
+			iSum += i_fnValue(cRead.load(nI));
+		iSink = iSink + iSum;
+	});
+	double dView = time_per_element(nElements,i_nPasses,[&]()
+	{
+		int64_t iSum = 0;
+		typename vector_type::read_control cRead(io_cVector);
+		for (const T & tElement : cRead.view())
+			iSum += i_fnValue(tElement);
+		iSink = iSink + iSum;
+	});
+	double dVisit = time_per_element(nElements,i_nPasses,[&]()
+	{
+		int64_t iSum = 0;
+		io_cVector.visit_range(0,nElements,[&](xstdtsl::span<const T> i_cRun)
+		{
+			for (const T & tElement : i_cRun)
+				iSum += i_fnValue(tElement);
+		});
+		iSink = iSink + iSum;
+	});
+	std::cout << i_pName << "\t" << nElements << "\t" << dIterator << "\t" << dLoad << "\t" << dView << "\t" << dVisit << std::endl;
+}
+
+int main(int i_nNum_Params, char * i_pParams[])
+{
+	size_t nElements = 1024 * 1024;
+	size_t nPasses = 10;
+	if (i_nNum_Params > 1)
+		nElements = std::strtoul(i_pParams[1],nullptr,10);
+	if (i_nNum_Params > 2)
+		nPasses = std::strtoul(i_pParams[2],nullptr,10);
+
+	std::cout << "--------------=============== zero-copy scan benchmark ===============--------------" << std::endl;
+	std::cout << "element\telements\tread_iterator load ns\tread_control load ns\tread_control view ns\tvisit_range ns" << std::endl;
+	{
+		xstdtsl::safe_vector<int64_t> cSV;
+		for (size_t nI = 0; nI < nElements; nI++)
+			cSV.push_back((int64_t)nI);
+		scan("int64_t",cSV,nPasses,[](const int64_t & i_iValue) { return i_iValue; });
+	}
+	{
+		xstdtsl::safe_vector<wide_record> cSV;
+		wide_record cRecord = {};
+		for (size_t nI = 0; nI < nElements / 8; nI++)
+		{
+			cRecord.m_lliValues[0] = (int64_t)nI;
+			cSV.push_back(cRecord);
+		}
+		scan("256-byte record",cSV,nPasses,[](const wide_record & i_cRecord) { return i_cRecord.m_lliValues[0]; });
+	}
+	{
+		// an element owning heap memory, whose copy the compiler can not elide
+		xstdtsl::safe_vector<std::string> cSV;
+		for (size_t nI = 0; nI < nElements / 8; nI++)
+			cSV.push_back(std::string(48,(char)('a' + nI % 26)));
+		scan("48-char string",cSV,nPasses,[](const std::string & i_sValue) { return (int64_t)i_sValue[0]; });
+	}
+	return 0;
+}
@@ -0,0 +1,45 @@
+#if defined _WIN32 || defined _WIN64
+#define __XSTDTSL_WINDOWS
+#include <windows.h>
+#pragma comment(lib,"Synchronization.lib")
+#elif defined __linux__
+#include <unistd.h>
+#include <errno.h>
+#include <limits.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#else
+#include <thread>
+#include <chrono>
+#endif
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <xstdtsl_system_C.h>
+
+void xstdtsl_wait_on_address(const void * i_pAddress, uint32_t i_uExpected) noexcept
+{
+#ifdef __XSTDTSL_WINDOWS
+	WaitOnAddress(const_cast<void *>(i_pAddress),&i_uExpected,sizeof(i_uExpected),INFINITE);
+#elif defined __linux__
+	// private futex: the word is only shared between threads of this process. returns on a wake, on a signal, or at once if the word no longer holds the expected value; callers recheck in every case
+	syscall(SYS_futex,i_pAddress,FUTEX_WAIT_PRIVATE,i_uExpected,nullptr,nullptr,0);
+#else
+	// no address wait primitive; poll with a short sleep
+	const std::atomic<uint32_t> * pWord = static_cast<const std::atomic<uint32_t> *>(i_pAddress);
+	while (pWord->load(std::memory_order_acquire) == i_uExpected)
+		std::this_thread::sleep_for(std::chrono::microseconds(50));
+#endif
+}
+
+void xstdtsl_wake_on_address(const void * i_pAddress, bool i_bAll) noexcept
+{
+#ifdef __XSTDTSL_WINDOWS
+	if (i_bAll)
+		WakeByAddressAll(const_cast<void *>(i_pAddress));
+	else
+		WakeByAddressSingle(const_cast<void *>(i_pAddress));
+#elif defined __linux__
+	syscall(SYS_futex,i_pAddress,FUTEX_WAKE_PRIVATE,i_bAll ? INT_MAX : 1,nullptr,nullptr,0);
+#endif
+}